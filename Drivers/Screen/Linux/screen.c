@@ -1110,6 +1110,9 @@ readScreenRow (int row, size_t size, ScreenCharacter *characters, int *offsets)
         if ((blanks > 0) && (wc == WC_C(' '))) {
           blanks -= 1;
           wc = WEOF;
+        } else if (wc < 0X80) {
+          /* ASCII never occupies more than one column */
+          blanks = 0;
         } else {
           blanks = getCharacterWidth(wc) - 1;
         }
@@ -187,12 +187,13 @@ readCharacters_ScreenScreen (const ScreenBox *box, ScreenCharacter *buffer) {
     unsigned char *attributes = text + (description.cols * description.rows);
     size_t increment = description.cols - box->width;
     int row;
+    wchar_t characters[box->width];
     for (row=0; row<box->height; row++) {
       int column;
+      convertCharsToWchars((const char *)text, characters, box->width, L'?');
+      text += box->width;
       for (column=0; column<box->width; column++) {
-        wint_t wc = convertCharToWchar(*text++);
-        if (wc == WEOF) wc = L'?';
-        character->text = wc;
+        character->text = characters[column];
         character->attributes = *attributes++;
         character++;
       }
@@ -0,0 +1,21 @@
+# Dependencies for speech.$O:
+speech.$O: $(SRC_DIR)/speech.c
+speech.$O: $(SRC_TOP)Headers/prologue.h
+speech.$O: $(BLD_TOP)config.h
+speech.$O: $(BLD_TOP)forbuild.h
+speech.$O: $(SRC_TOP)Headers/log.h
+speech.$O: $(SRC_TOP)Headers/parse.h
+speech.$O: $(SRC_TOP)Headers/timing.h
+speech.$O: $(SRC_TOP)Headers/get_thread.h
+speech.$O: $(SRC_TOP)Headers/gettime.h
+speech.$O: $(SRC_TOP)Headers/thread.h
+speech.$O: $(SRC_TOP)Headers/win_pthread.h
+speech.$O: $(SRC_TOP)Headers/note_types.h
+speech.$O: $(SRC_TOP)Headers/notes.h
+speech.$O: $(SRC_TOP)Headers/pcm.h
+speech.$O: $(SRC_TOP)Headers/driver.h
+speech.$O: $(SRC_TOP)Headers/spk.h
+speech.$O: $(SRC_TOP)Headers/spk_base.h
+speech.$O: $(SRC_TOP)Headers/spk_driver.h
+speech.$O: $(SRC_TOP)Headers/spk_types.h
+
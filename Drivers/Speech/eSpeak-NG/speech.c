@@ -21,17 +21,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <signal.h>
+#include <errno.h>
 
 #include "log.h"
 #include "parse.h"
+#include "timing.h"
+#include "thread.h"
+#include "notes.h"
+#include "pcm.h"
 
 typedef enum {
 	PARM_PATH,
 	PARM_PUNCTLIST,
 	PARM_VOICE,
-	PARM_MAXRATE
+	PARM_MAXRATE,
+	PARM_CACHE
 } DriverParameter;
-#define SPKPARMS "path", "punctlist", "voice", "maxrate"
+#define SPKPARMS "path", "punctlist", "voice", "maxrate", "cache"
 
 #include "spk_driver.h"
 
@@ -39,11 +46,677 @@ typedef enum {
 
 static int maxrate = espeakRATE_MAXIMUM;
 
+/*
+ * When the cache parameter is set the driver synthesizes into PCM
+ * (AUDIO_OUTPUT_SYNCHRONOUS) on its own audio thread and plays the samples
+ * through BRLTTY's PCM device. Short utterances are kept, along with their
+ * word positions, in an LRU cache which is keyed by the text and by every
+ * setting which affects the rendering, so that what's spoken again and again
+ * (menu items, characters, punctuation) starts playing immediately.
+ */
+
+#define CACHE_TEXT_LIMIT 0X80
+#define PLAYBACK_CHUNK_SAMPLES 0X400
+#define SYNTHESIS_BUFFER_MSECS 60
+
+typedef struct {
+	size_t offset;
+	int position;
+} SpeechMark;
+
+typedef struct UtteranceStruct Utterance;
+struct UtteranceStruct {
+	Utterance *newer;
+	Utterance *older;
+	uint32_t hash;
+
+	size_t keyLength;
+	char *key;
+
+	short *samples;
+	size_t sampleCount;
+	size_t sampleSize;
+
+	SpeechMark *marks;
+	unsigned int markCount;
+	unsigned int markSize;
+};
+
+typedef struct {
+	int volume;
+	int rate;
+	int pitch;
+	int punctuation;
+} SpeechSettings;
+
+typedef struct SpeechRequestStruct SpeechRequest;
+struct SpeechRequestStruct {
+	SpeechRequest *next;
+	SpeechSettings settings;
+	TimeValue enqueued;
+	size_t length;
+	char text[];
+};
+
+static struct {
+	SpeechSynthesizer *spk;
+	PcmDevice *pcm;
+	int sampleRate;
+	unsigned int cacheLimit;
+	char *voice;
+
+	SpeechSettings settings;
+	SpeechSettings applied;
+
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t condition;
+	unsigned started:1;
+	unsigned stop:1;
+	unsigned busy:1;
+
+	/* set under the mutex but also tested, unlocked, while synthesizing */
+	volatile sig_atomic_t cancel;
+
+	SpeechRequest *first;
+	SpeechRequest *last;
+
+	/* when what has been written to the PCM device will have been played */
+	TimeValue outputEnd;
+
+	struct {
+		Utterance *newest;
+		Utterance *oldest;
+		unsigned int count;
+	} cache;
+
+	struct {
+		SpeechRequest *request;
+		Utterance *utterance;
+		unsigned startPending:1;
+	} synthesis;
+
+	struct {
+		unsigned long hits;
+		unsigned long misses;
+		unsigned long started;
+		unsigned long firstSampleTotal;
+		long firstSampleMaximum;
+	} statistics;
+} audio;
+
+static int
+isCacheMode(void)
+{
+	return audio.pcm != NULL;
+}
+
+static uint32_t
+hashUtteranceKey(const char *key, size_t length)
+{
+	uint32_t hash = UINT32_C(0X811C9DC5);
+
+	while (length--) {
+		hash ^= (unsigned char)*key++;
+		hash *= UINT32_C(0X01000193);
+	}
+
+	return hash;
+}
+
+static size_t
+makeUtteranceKey(char *buffer, size_t size, const SpeechRequest *request)
+{
+	const SpeechSettings *settings = &request->settings;
+	int length = snprintf(buffer, size, "%s:%d:%d:%d:%d:",
+			audio.voice, settings->volume, settings->rate,
+			settings->pitch, settings->punctuation);
+
+	if ((length < 0) || ((size_t)length + request->length > size))
+		return 0;
+
+	memcpy(&buffer[length], request->text, request->length);
+	return length + request->length;
+}
+
+static void
+deallocateUtterance(Utterance *utterance)
+{
+	if (utterance->samples) free(utterance->samples);
+	if (utterance->marks) free(utterance->marks);
+	if (utterance->key) free(utterance->key);
+	free(utterance);
+}
+
+static void
+unlinkUtterance(Utterance *utterance)
+{
+	if (utterance->newer)
+		utterance->newer->older = utterance->older;
+	else
+		audio.cache.newest = utterance->older;
+
+	if (utterance->older)
+		utterance->older->newer = utterance->newer;
+	else
+		audio.cache.oldest = utterance->newer;
+
+	utterance->newer = utterance->older = NULL;
+	audio.cache.count -= 1;
+}
+
+static void
+linkUtterance(Utterance *utterance)
+{
+	utterance->older = audio.cache.newest;
+	utterance->newer = NULL;
+
+	if (audio.cache.newest)
+		audio.cache.newest->newer = utterance;
+	else
+		audio.cache.oldest = utterance;
+
+	audio.cache.newest = utterance;
+	audio.cache.count += 1;
+}
+
+static Utterance *
+findUtterance(const char *key, size_t length, uint32_t hash)
+{
+	Utterance *utterance = audio.cache.newest;
+
+	while (utterance) {
+		if ((utterance->hash == hash) && (utterance->keyLength == length) &&
+		    (memcmp(utterance->key, key, length) == 0)) {
+			/* most recently used */
+			unlinkUtterance(utterance);
+			linkUtterance(utterance);
+			return utterance;
+		}
+
+		utterance = utterance->older;
+	}
+
+	return NULL;
+}
+
+static void
+cacheUtterance(Utterance *utterance)
+{
+	linkUtterance(utterance);
+
+	while (audio.cache.count > audio.cacheLimit) {
+		Utterance *oldest = audio.cache.oldest;
+		unlinkUtterance(oldest);
+		deallocateUtterance(oldest);
+	}
+}
+
+static void
+clearUtteranceCache(void)
+{
+	while (audio.cache.oldest) {
+		Utterance *oldest = audio.cache.oldest;
+		unlinkUtterance(oldest);
+		deallocateUtterance(oldest);
+	}
+}
+
+static Utterance *
+newUtterance(const char *key, size_t length, uint32_t hash)
+{
+	Utterance *utterance;
+
+	if ((utterance = malloc(sizeof(*utterance)))) {
+		memset(utterance, 0, sizeof(*utterance));
+		utterance->hash = hash;
+
+		if ((utterance->key = malloc(length))) {
+			memcpy(utterance->key, key, length);
+			utterance->keyLength = length;
+			return utterance;
+		}
+
+		free(utterance);
+	}
+
+	logMallocError();
+	return NULL;
+}
+
+static int
+addUtteranceSamples(Utterance *utterance, const short *samples, size_t count)
+{
+	if (utterance->sampleCount + count > utterance->sampleSize) {
+		size_t newSize = MAX(utterance->sampleSize * 2,
+				utterance->sampleCount + count);
+		short *newSamples = realloc(utterance->samples,
+				ARRAY_SIZE(newSamples, newSize));
+
+		if (!newSamples) {
+			logMallocError();
+			return 0;
+		}
+
+		utterance->samples = newSamples;
+		utterance->sampleSize = newSize;
+	}
+
+	memcpy(&utterance->samples[utterance->sampleCount], samples,
+		ARRAY_SIZE(samples, count));
+	utterance->sampleCount += count;
+	return 1;
+}
+
+static int
+addUtteranceMark(Utterance *utterance, size_t offset, int position)
+{
+	if (utterance->markCount == utterance->markSize) {
+		unsigned int newSize = utterance->markSize? utterance->markSize<<1: 0X10;
+		SpeechMark *newMarks = realloc(utterance->marks,
+				ARRAY_SIZE(newMarks, newSize));
+
+		if (!newMarks) {
+			logMallocError();
+			return 0;
+		}
+
+		utterance->marks = newMarks;
+		utterance->markSize = newSize;
+	}
+
+	{
+		SpeechMark *mark = &utterance->marks[utterance->markCount++];
+		mark->offset = offset;
+		mark->position = position;
+	}
+
+	return 1;
+}
+
+static void
+noteFirstSample(const SpeechRequest *request)
+{
+	long elapsed = getMonotonicElapsed(&request->enqueued);
+
+	audio.statistics.started += 1;
+	audio.statistics.firstSampleTotal += elapsed;
+	if (elapsed > audio.statistics.firstSampleMaximum)
+		audio.statistics.firstSampleMaximum = elapsed;
+
+	logMessage(LOG_CATEGORY(SPEECH_EVENTS),
+		"eSpeak-NG time to first sample: %ldms", elapsed);
+}
+
+static void
+logAudioStatistics(void)
+{
+	unsigned long lookups = audio.statistics.hits + audio.statistics.misses;
+	unsigned long started = audio.statistics.started;
+
+	logMessage(LOG_INFO,
+		"eSpeak-NG cache statistics: Hits:%lu/%lu (%lu%%) First Sample:%lums avg %ldms max",
+		audio.statistics.hits, lookups,
+		lookups? (audio.statistics.hits * 100) / lookups: 0,
+		started? audio.statistics.firstSampleTotal / started: 0,
+		audio.statistics.firstSampleMaximum);
+}
+
+/* called with the mutex unlocked */
+static int
+playSamples(const short *samples, size_t count)
+{
+	TimeValue now;
+
+	if (!writePcmData(audio.pcm, (const unsigned char *)samples,
+			ARRAY_SIZE(samples, count)))
+		return 0;
+
+	getCurrentTime(&now);
+	if (compareTimeValues(&audio.outputEnd, &now) < 0)
+		audio.outputEnd = now;
+	adjustTimeValue(&audio.outputEnd, (count * MSECS_PER_SEC) / audio.sampleRate);
+	return 1;
+}
+
+static void
+playUtterance(const SpeechRequest *request, const Utterance *utterance)
+{
+	size_t offset = 0;
+	unsigned int mark = 0;
+
+	noteFirstSample(request);
+
+	while (offset < utterance->sampleCount) {
+		size_t count = utterance->sampleCount - offset;
+
+		while ((mark < utterance->markCount) &&
+		       (utterance->marks[mark].offset <= offset)) {
+			tellSpeechLocation(audio.spk, utterance->marks[mark++].position);
+		}
+
+		if (mark < utterance->markCount)
+			count = MIN(count, utterance->marks[mark].offset - offset);
+		count = MIN(count, PLAYBACK_CHUNK_SAMPLES);
+
+		if (audio.cancel) return;
+		if (!playSamples(&utterance->samples[offset], count)) return;
+		offset += count;
+	}
+}
+
+static int
+synthesisCallback(short *samples, int count, espeak_EVENT *events)
+{
+	Utterance *utterance = audio.synthesis.utterance;
+	size_t offset = utterance? utterance->sampleCount: 0;
+
+	if (audio.cancel) return 1;
+
+	while (events->type != espeakEVENT_LIST_TERMINATED) {
+		if (events->type == espeakEVENT_WORD) {
+			int position = events->text_position - 1;
+
+			tellSpeechLocation(audio.spk, position);
+
+			if (utterance) {
+				size_t mark = ((size_t)events->audio_position * audio.sampleRate) / MSECS_PER_SEC;
+				if (!addUtteranceMark(utterance, MAX(mark, offset), position))
+					audio.synthesis.utterance = NULL;
+			}
+		}
+
+		events++;
+	}
+
+	if (samples && (count > 0)) {
+		if (audio.synthesis.startPending) {
+			audio.synthesis.startPending = 0;
+			noteFirstSample(audio.synthesis.request);
+		}
+
+		if ((utterance = audio.synthesis.utterance)) {
+			if (!addUtteranceSamples(utterance, samples, count))
+				audio.synthesis.utterance = NULL;
+		}
+
+		if (!playSamples(samples, count)) return 1;
+	}
+
+	return audio.cancel;
+}
+
+static void
+applySpeechSettings(const SpeechSettings *settings)
+{
+	if (settings->volume != audio.applied.volume)
+		espeak_SetParameter(espeakVOLUME, settings->volume, 0);
+	if (settings->rate != audio.applied.rate)
+		espeak_SetParameter(espeakRATE, settings->rate, 0);
+	if (settings->pitch != audio.applied.pitch)
+		espeak_SetParameter(espeakPITCH, settings->pitch, 0);
+	if (settings->punctuation != audio.applied.punctuation)
+		espeak_SetParameter(espeakPUNCTUATION, settings->punctuation, 0);
+
+	audio.applied = *settings;
+}
+
+/* called with the mutex locked, returns with it locked */
+static void
+speakRequest(SpeechRequest *request)
+{
+	char key[0X40 + CACHE_TEXT_LIMIT];
+	size_t length = (request->length <= CACHE_TEXT_LIMIT)?
+			makeUtteranceKey(key, sizeof(key), request): 0;
+	uint32_t hash = length? hashUtteranceKey(key, length): 0;
+	Utterance *utterance = NULL;
+
+	if (length) {
+		if ((utterance = findUtterance(key, length, hash))) {
+			audio.statistics.hits += 1;
+
+			/* the cache isn't changed while the mutex is unlocked (by this thread) */
+			unlockMutex(&audio.mutex);
+			playUtterance(request, utterance);
+			lockMutex(&audio.mutex);
+			return;
+		}
+
+		audio.statistics.misses += 1;
+		utterance = newUtterance(key, length, hash);
+	}
+
+	unlockMutex(&audio.mutex);
+	{
+		int result;
+
+		applySpeechSettings(&request->settings);
+		audio.synthesis.request = request;
+		audio.synthesis.utterance = utterance;
+		audio.synthesis.startPending = 1;
+
+		/* add 1 to the length in order to pass along the trailing zero */
+		result = espeak_Synth(request->text, request->length+1, 0, POS_CHARACTER, 0,
+				espeakCHARS_UTF8, NULL, NULL);
+		if ((result != EE_OK) && !audio.cancel)
+			logMessage(LOG_ERR, "eSpeak-NG: Synth() returned error %d", result);
+
+		if (!audio.synthesis.utterance || (result != EE_OK) || audio.cancel) {
+			if (utterance) deallocateUtterance(utterance);
+			utterance = NULL;
+		}
+
+		audio.synthesis.utterance = NULL;
+		audio.synthesis.request = NULL;
+	}
+	lockMutex(&audio.mutex);
+
+	if (utterance) cacheUtterance(utterance);
+}
+
+THREAD_FUNCTION(runAudioThread)
+{
+	lockMutex(&audio.mutex);
+
+	while (!audio.stop) {
+		SpeechRequest *request = audio.first;
+
+		if (!request) {
+			audio.busy = 0;
+			pthread_cond_broadcast(&audio.condition);
+			pthread_cond_wait(&audio.condition, &audio.mutex);
+			continue;
+		}
+
+		if (!(audio.first = request->next)) audio.last = NULL;
+		audio.busy = 1;
+		audio.cancel = 0;
+
+		speakRequest(request);
+		free(request);
+
+		if (!audio.cancel) {
+			unlockMutex(&audio.mutex);
+			pushPcmOutput(audio.pcm);
+			lockMutex(&audio.mutex);
+
+			/* wait for the output to be played, but not if there's
+			 * more to say or if it's been muted in the meantime
+			 */
+			while (!audio.first && !audio.cancel) {
+				const struct timespec timeout = {
+					.tv_sec = audio.outputEnd.seconds,
+					.tv_nsec = audio.outputEnd.nanoseconds
+				};
+
+				if (pthread_cond_timedwait(&audio.condition, &audio.mutex, &timeout) == ETIMEDOUT) {
+					unlockMutex(&audio.mutex);
+					awaitPcmOutput(audio.pcm);
+					lockMutex(&audio.mutex);
+					break;
+				}
+			}
+
+			if (!audio.cancel) {
+				unlockMutex(&audio.mutex);
+				tellSpeechFinished(audio.spk);
+				lockMutex(&audio.mutex);
+			}
+		}
+
+		/* the PCM device is only ever used by this thread */
+		if (audio.cancel) {
+			unlockMutex(&audio.mutex);
+			cancelPcmOutput(audio.pcm);
+			getCurrentTime(&audio.outputEnd);
+			lockMutex(&audio.mutex);
+		}
+	}
+
+	unlockMutex(&audio.mutex);
+	return NULL;
+}
+
+static void
+discardSpeechRequests(void)
+{
+	while (audio.first) {
+		SpeechRequest *request = audio.first;
+		audio.first = request->next;
+		free(request);
+	}
+
+	audio.last = NULL;
+}
+
+static int
+openAudio(SpeechSynthesizer *spk, char **parameters)
+{
+	const char *parameter = parameters[PARM_CACHE];
+	int limit = 0;
+
+	if (parameter && *parameter) {
+		static const int minimum = 0;
+
+		if (!validateInteger(&limit, parameter, &minimum, NULL)) {
+			logMessage(LOG_WARNING, "%s: %s", "invalid cache size", parameter);
+			limit = 0;
+		}
+	}
+
+	if (!limit) return 0;
+
+	if (!(audio.pcm = openPcmDevice(LOG_WARNING, opt_pcmDevice))) {
+		logMessage(LOG_WARNING, "eSpeak-NG: cache disabled - no PCM device");
+		return 0;
+	}
+
+	if ((setPcmChannelCount(audio.pcm, 1) != 1) ||
+	    (setPcmAmplitudeFormat(audio.pcm, PCM_FMT_S16N) != PCM_FMT_S16N)) {
+		logMessage(LOG_WARNING, "eSpeak-NG: cache disabled - unsupported PCM format");
+		closePcmDevice(audio.pcm);
+		audio.pcm = NULL;
+		return 0;
+	}
+
+	audio.spk = spk;
+	audio.cacheLimit = limit;
+	return 1;
+}
+
+static int
+startAudio(int sampleRate)
+{
+	audio.sampleRate = setPcmSampleRate(audio.pcm, sampleRate);
+	if (audio.sampleRate != sampleRate)
+		logMessage(LOG_WARNING, "eSpeak-NG: PCM sample rate mismatch: %d != %d",
+			audio.sampleRate, sampleRate);
+
+	pthread_mutex_init(&audio.mutex, NULL);
+	pthread_cond_init(&audio.condition, NULL);
+	audio.applied.volume = audio.applied.rate = -1;
+	audio.applied.pitch = audio.applied.punctuation = -1;
+
+	int error = createThread("espeak-ng-audio", &audio.thread, NULL, runAudioThread, NULL);
+	if (!error) {
+		audio.started = 1;
+		return 1;
+	}
+
+	logMessage(LOG_ERR, "eSpeak-NG: cannot create audio thread: %s", strerror(error));
+
+	pthread_cond_destroy(&audio.condition);
+	pthread_mutex_destroy(&audio.mutex);
+	return 0;
+}
+
+static void
+stopAudio(void)
+{
+	if (audio.started) {
+		lockMutex(&audio.mutex);
+		audio.stop = 1;
+		audio.cancel = 1;
+		discardSpeechRequests();
+		pthread_cond_broadcast(&audio.condition);
+		unlockMutex(&audio.mutex);
+
+		pthread_join(audio.thread, NULL);
+		audio.started = 0;
+
+		logAudioStatistics();
+		clearUtteranceCache();
+		pthread_cond_destroy(&audio.condition);
+		pthread_mutex_destroy(&audio.mutex);
+	}
+
+	if (audio.pcm) {
+		closePcmDevice(audio.pcm);
+		audio.pcm = NULL;
+	}
+
+	if (audio.voice) {
+		free(audio.voice);
+		audio.voice = NULL;
+	}
+}
+
+static void
+enqueueSpeechRequest(const unsigned char *buffer, size_t length)
+{
+	SpeechRequest *request;
+
+	if ((request = malloc(sizeof(*request) + length + 1))) {
+		request->next = NULL;
+		request->settings = audio.settings;
+		getMonotonicTime(&request->enqueued);
+		request->length = length;
+		memcpy(request->text, buffer, length);
+		request->text[length] = 0;
+
+		lockMutex(&audio.mutex);
+		if (audio.last)
+			audio.last->next = request;
+		else
+			audio.first = request;
+		audio.last = request;
+		pthread_cond_broadcast(&audio.condition);
+		unlockMutex(&audio.mutex);
+	} else {
+		logMallocError();
+	}
+}
+
 static void
 spk_say(SpeechSynthesizer *spk, const unsigned char *buffer, size_t length, size_t count, const unsigned char *attributes)
 {
 	int result;
 
+	if (isCacheMode()) {
+		enqueueSpeechRequest(buffer, length);
+		return;
+	}
+
 	/* add 1 to the length in order to pass along the trailing zero */
 	result = espeak_Synth(buffer, length+1, 0, POS_CHARACTER, 0,
 			espeakCHARS_UTF8, NULL, (void *)spk);
@@ -54,6 +727,16 @@ spk_say(SpeechSynthesizer *spk, const unsigned char *buffer, size_t length, size
 static void
 spk_mute(SpeechSynthesizer *spk)
 {
+	if (isCacheMode()) {
+		/* the audio thread flushes the PCM output */
+		lockMutex(&audio.mutex);
+		discardSpeechRequests();
+		audio.cancel = 1;
+		pthread_cond_broadcast(&audio.condition);
+		unlockMutex(&audio.mutex);
+		return;
+	}
+
 	espeak_Cancel();
 }
 
@@ -74,6 +757,14 @@ static int SynthCallback(short *audio, int numsamples, espeak_EVENT *events)
 static void
 spk_drain(SpeechSynthesizer *spk)
 {
+	if (isCacheMode()) {
+		lockMutex(&audio.mutex);
+		while (audio.first || audio.busy)
+			pthread_cond_wait(&audio.condition, &audio.mutex);
+		unlockMutex(&audio.mutex);
+		return;
+	}
+
 	espeak_Synchronize();
 }
 
@@ -81,7 +772,10 @@ static void
 spk_setVolume(SpeechSynthesizer *spk, unsigned char setting)
 {
 	int volume = getIntegerSpeechVolume(setting, 50);
-	espeak_SetParameter(espeakVOLUME, volume, 0);
+	if (isCacheMode())
+		audio.settings.volume = volume;
+	else
+		espeak_SetParameter(espeakVOLUME, volume, 0);
 }
 
 static void
@@ -89,14 +783,20 @@ spk_setRate(SpeechSynthesizer *spk, unsigned char setting)
 {
 	int h_range = (maxrate - espeakRATE_MINIMUM)/2;
 	int rate = getIntegerSpeechRate(setting, h_range) + espeakRATE_MINIMUM;
-	espeak_SetParameter(espeakRATE, rate, 0);
+	if (isCacheMode())
+		audio.settings.rate = rate;
+	else
+		espeak_SetParameter(espeakRATE, rate, 0);
 }
 
 static void
 spk_setPitch(SpeechSynthesizer *spk, unsigned char setting)
 {
 	int pitch = getIntegerSpeechPitch(setting, 50);
-	espeak_SetParameter(espeakPITCH, pitch, 0);
+	if (isCacheMode())
+		audio.settings.pitch = pitch;
+	else
+		espeak_SetParameter(espeakPITCH, pitch, 0);
 }
 
 static void
@@ -109,13 +809,18 @@ spk_setPunctuation(SpeechSynthesizer *spk, SpeechPunctuation setting)
 		punct = espeakPUNCT_ALL;
 	else
 		punct = espeakPUNCT_SOME;
-	espeak_SetParameter(espeakPUNCTUATION, punct, 0);
+	if (isCacheMode())
+		audio.settings.punctuation = punct;
+	else
+		espeak_SetParameter(espeakPUNCTUATION, punct, 0);
 }
 
 static int spk_construct(SpeechSynthesizer *spk, char **parameters)
 {
 	const char *data_path, *voicename, *punctlist;
 	int result;
+	int cache;
+	int sampleRate;
 
 	spk->setVolume = spk_setVolume;
 	spk->setRate = spk_setRate;
@@ -125,12 +830,19 @@ static int spk_construct(SpeechSynthesizer *spk, char **parameters)
 
 	logMessage(LOG_INFO, "eSpeak-NG version %s", espeak_Info(NULL));
 
+	memset(&audio, 0, sizeof(audio));
+	cache = openAudio(spk, parameters);
+
 	data_path = parameters[PARM_PATH];
 	if (data_path && !*data_path)
 		data_path = NULL;
-	result = espeak_Initialize(AUDIO_OUTPUT_PLAYBACK, 0, data_path, 0);
+	result = cache?
+		espeak_Initialize(AUDIO_OUTPUT_SYNCHRONOUS, SYNTHESIS_BUFFER_MSECS, data_path, 0):
+		espeak_Initialize(AUDIO_OUTPUT_PLAYBACK, 0, data_path, 0);
+	sampleRate = result;
 	if (result < 0) {
 		logMessage(LOG_ERR, "eSpeak-NG: initialization failed");
+		stopAudio();
 		return 0;
 	}
 
@@ -146,6 +858,8 @@ static int spk_construct(SpeechSynthesizer *spk, char **parameters)
 	}
 	if (result != EE_OK) {
 		logMessage(LOG_ERR, "eSpeak-NG: unable to load voice '%s'", voicename);
+		stopAudio();
+		espeak_Terminate();
 		return 0;
 	}
 
@@ -162,6 +876,20 @@ static int spk_construct(SpeechSynthesizer *spk, char **parameters)
 		if (val > espeakRATE_MINIMUM) maxrate = val;
 	}
 
+	if (cache) {
+		espeak_SetSynthCallback(synthesisCallback);
+
+		if (!(audio.voice = strdup(voicename))) {
+			logMallocError();
+		} else if (startAudio(sampleRate)) {
+			return 1;
+		}
+
+		stopAudio();
+		espeak_Terminate();
+		return 0;
+	}
+
 	espeak_SetSynthCallback(SynthCallback);
 
 	return 1;
@@ -169,6 +897,12 @@ static int spk_construct(SpeechSynthesizer *spk, char **parameters)
 
 static void spk_destruct(SpeechSynthesizer *spk)
 {
+	if (isCacheMode()) {
+		stopAudio();
+		espeak_Terminate();
+		return;
+	}
+
 	espeak_Cancel();
 	espeak_Terminate();
 }
@@ -36,6 +36,7 @@ typedef struct {
 typedef ASYNC_EVENT_CALLBACK(AsyncEventCallback);
 
 extern AsyncEvent *asyncNewEvent (AsyncEventCallback *callback, void *data);
+extern AsyncEvent *asyncNewLimitedEvent (AsyncEventCallback *callback, void *data, unsigned int limit);
 extern void asyncDiscardEvent (AsyncEvent *event);
 extern int asyncSignalEvent (AsyncEvent *event, void *data);
 
@@ -24,6 +24,7 @@
 #include "gio_types.h"
 #include "queue.h"
 #include "async.h"
+#include "timing.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -109,7 +110,26 @@ struct BrailleDisplayStruct {
       unsigned int count;
       unsigned int limit;
     } missing;
+
+    struct {
+      TimeValue time;
+      size_t size;
+    } pending;
   } acknowledgements;
+
+  struct {
+    TimeValue busyUntil;
+    int acknowledgementLatency;
+
+    struct {
+      TimeValue since;
+      unsigned int written;
+      unsigned int dropped;
+      unsigned int checksum;
+      int latency;
+      unsigned char isPending:1;
+    } frames;
+  } pacing;
 };
 
 static inline int
@@ -27,6 +27,12 @@ extern "C" {
 
 extern void drainBrailleOutput (BrailleDisplay *brl, int minimumDelay);
 
+extern void smoothBrailleMeasurement (int *average, int sample);
+extern int getBrailleOutputBusyTime (BrailleDisplay *brl);
+extern int deferBrailleWindow (BrailleDisplay *brl, int *delay);
+extern void noteBrailleWindowWritten (BrailleDisplay *brl);
+extern void logBrailleOutputStatistics (BrailleDisplay *brl);
+
 extern void announceBrailleOffline (void);
 extern void announceBrailleOnline (void);
 
@@ -43,6 +43,9 @@ extern int convertUtf8ToChar (const char **utf8, size_t *utfs);
 extern wint_t convertCharToWchar (char c);
 extern int convertWcharToChar (wchar_t wc);
 
+extern void convertCharsToWchars (const char *chars, wchar_t *characters, size_t count, wchar_t substitute);
+extern void convertWcharsToChars (const wchar_t *characters, char *chars, size_t count, char substitute);
+
 extern int lockCharset (LockOptions options);
 extern void unlockCharset (void);
 
@@ -54,12 +54,16 @@ extern int cldrParseDocument (
 
 extern const char cldrAnnotationsDirectory[];
 extern const char cldrAnnotationsExtension[];
+extern const char cldrCompiledExtension[];
+extern const char cldrCompiledSubdirectory[];
 
 extern int cldrParseFile (
   const char *name,
   CLDR_AnnotationHandler *handler, void *data
 );
 
+extern int cldrCompileFile (const char *name, const char *path);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
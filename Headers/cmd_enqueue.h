@@ -24,6 +24,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 extern int enqueueCommand (int command);
+extern int enqueueRepeatedCommand (int command);
 
 #ifdef __cplusplus
 }
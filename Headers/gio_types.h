@@ -96,7 +96,8 @@ typedef enum {
   GIO_TYPE_NULL,
   GIO_TYPE_SERIAL,
   GIO_TYPE_USB,
-  GIO_TYPE_BLUETOOTH
+  GIO_TYPE_BLUETOOTH,
+  GIO_TYPE_REPLAY
 } GioTypeIdentifier;
 
 typedef struct {
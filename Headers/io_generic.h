@@ -124,6 +124,9 @@ extern void gioDestroyHandleInputObject (GioHandleInputObject *hio);
 extern GioTypeIdentifier gioGetResourceType (GioEndpoint *endpoint);
 extern void *gioGetResourceObject (GioEndpoint *endpoint);
 
+extern int gioIsNotingInputPackets (GioEndpoint *endpoint);
+extern void gioNoteInputPacket (GioEndpoint *endpoint, size_t size, unsigned long int nanoseconds);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -263,6 +263,34 @@ extern int usbHidGetReportSize (
   size_t *size
 );
 
+typedef struct UsbHidReportTableStruct UsbHidReportTable;
+
+extern UsbHidReportTable *usbHidNewReportTable (
+  const unsigned char *items,
+  size_t size
+);
+
+extern void usbHidDestroyReportTable (UsbHidReportTable *table);
+
+extern int usbHidTestReportTable (
+  const UsbHidReportTable *table,
+  const unsigned char *items,
+  size_t size
+);
+
+extern const UsbHidReportDescription *usbHidGetReportDescription (
+  const UsbHidReportTable *table,
+  unsigned char identifier
+);
+
+extern int usbHidGetCachedReportSize (
+  UsbDevice *device,
+  const unsigned char *items,
+  size_t length,
+  unsigned char identifier,
+  size_t *size
+);
+
 extern ssize_t usbHidGetReport (
   UsbDevice *device,
   unsigned char interface,
@@ -0,0 +1,85 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#ifndef BRLTTY_INCLUDED_LATENCY
+#define BRLTTY_INCLUDED_LATENCY
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The stages of the path from a key packet to the resulting braille output. */
+typedef enum {
+  LATENCY_STAGE_PACKET,     /* readBraillePacket() returned the packet */
+  LATENCY_STAGE_KEY,        /* enqueueKeyEvent() */
+  LATENCY_STAGE_BINDING,    /* the key table resolved a command */
+  LATENCY_STAGE_QUEUED,     /* enqueueCommand() */
+  LATENCY_STAGE_HANDLED,    /* the command was dequeued for handleCommand() */
+  LATENCY_STAGE_SCHEDULED,  /* scheduleUpdate() */
+  LATENCY_STAGE_UPDATE,     /* doUpdate() */
+  LATENCY_STAGE_OUTPUT,     /* the driver's writeWindow() returned */
+  LATENCY_STAGE_COUNT
+} LatencyStage;
+
+/* A correlation identifier - 0 means that nothing is being traced. */
+typedef uint32_t LatencyTrace;
+
+#ifdef ENABLE_LATENCY_TRACING
+extern void setLatencyOrigin (int active);
+extern LatencyTrace beginLatencyTrace (void);
+extern void traceLatency (LatencyTrace trace, LatencyStage stage);
+
+extern LatencyTrace getLatencyTrace (void);
+extern void setLatencyTrace (LatencyTrace trace);
+
+extern void logLatencyStatistics (void);
+
+#else /* ENABLE_LATENCY_TRACING */
+static inline void
+setLatencyOrigin (int active) {
+}
+
+static inline LatencyTrace
+beginLatencyTrace (void) {
+  return 0;
+}
+
+static inline void
+traceLatency (LatencyTrace trace, LatencyStage stage) {
+}
+
+static inline LatencyTrace
+getLatencyTrace (void) {
+  return 0;
+}
+
+static inline void
+setLatencyTrace (LatencyTrace trace) {
+}
+
+static inline void
+logLatencyStatistics (void) {
+}
+#endif /* ENABLE_LATENCY_TRACING */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_LATENCY */
@@ -36,11 +36,13 @@ extern const LogEntry *getPreviousLogEntry (const LogEntry *entry);
 extern const char *getLogEntryText (const LogEntry *entry);
 extern const TimeValue *getLogEntryTime (const LogEntry *entry);
 extern unsigned int getLogEntryCount (const LogEntry *entry);
+extern unsigned long getLogEntrySequence (const LogEntry *entry);
 
 extern int pushLogEntry (LogEntry **head, const char *text, LogEntryPushOptions options);
 extern int popLogEntry (LogEntry **head);
 
-extern const LogEntry *getNewestLogMessage (int freeze);
+typedef int LogMessageHandler (const LogEntry *message, void *data);
+extern int forEachLogMessage (unsigned long after, int freeze, LogMessageHandler *handler, void *data);
 extern void pushLogMessage (const char *message);
 
 #ifdef __cplusplus
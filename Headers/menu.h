@@ -78,6 +78,8 @@ extern Menu *newSubmenuMenuItem (
   Menu *menu, const MenuString *name
 );
 
+extern void removeMenuItem (Menu *menu, unsigned int index);
+
 typedef int MenuItemTester (void);
 extern void setMenuItemTester (MenuItem *item, MenuItemTester *handler);
 
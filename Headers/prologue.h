@@ -25,6 +25,7 @@ extern "C" {
 
 #undef HAVE_BUILTIN_POPCOUNT
 #undef HAVE_SYNC_SYNCHRONIZE
+#undef HAVE_SYNC_BOOL_COMPARE_AND_SWAP
 
 #ifdef __has_builtin
 #if __has_builtin(__builtin_popcount)
@@ -34,6 +35,10 @@ extern "C" {
 #if __has_builtin(__sync_synchronize)
 #define HAVE_SYNC_SYNCHRONIZE
 #endif /* __has_builtin(__sync_synchronize) */
+
+#if __has_builtin(__sync_bool_compare_and_swap)
+#define HAVE_SYNC_BOOL_COMPARE_AND_SWAP
+#endif /* __has_builtin(__sync_bool_compare_and_swap) */
 #endif /* __has_builtin */
 
 #ifndef HAVE_SYNC_SYNCHRONIZE
@@ -65,6 +65,15 @@ extern Element *findElement (const Queue *queue, ItemTester *testItem, void *dat
 extern void *findItem (const Queue *queue, ItemTester *testItem, void *data);
 extern Element *findElementWithItem (const Queue *queue, void *item);
 
+/* An optional hash index. The key of an item mustn't change while it's queued.
+ * Without an index the find...WithKey functions fall back to a linear search.
+ */
+typedef uint64_t ItemKey;
+typedef ItemKey ItemKeyMaker (const void *item, void *queueData);
+extern int setQueueKeyMaker (Queue *queue, ItemKeyMaker *makeKey);
+extern Element *findElementWithKey (const Queue *queue, ItemKey key, ItemTester *testItem, void *data);
+extern void *findItemWithKey (const Queue *queue, ItemKey key, ItemTester *testItem, void *data);
+
 typedef int ItemProcessor (void *item, void *data);
 extern Element *processQueue (Queue *queue, ItemProcessor *processItem, void *data);
 
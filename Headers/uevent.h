@@ -0,0 +1,58 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_UEVENT
+#define BRLTTY_INCLUDED_UEVENT
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+  const char *action;
+  const char *device;
+  const char *subsystem;
+  const char *const *properties;
+  void *listenerData;
+} UeventListenerParameters;
+
+#define UEVENT_LISTENER(name) void name (const UeventListenerParameters *parameters)
+typedef UEVENT_LISTENER(UeventListener);
+typedef struct UeventListenerInstanceStruct UeventListenerInstance;
+
+extern UeventListenerInstance *registerUeventListener (
+  const char *subsystem,
+  UeventListener *listener,
+  void *data
+);
+
+extern void unregisterUeventListener (UeventListenerInstance *uli);
+
+extern const char *getUeventProperty (
+  const UeventListenerParameters *parameters,
+  const char *name
+);
+
+extern int handleUeventMessage (const void *buffer, size_t size);
+extern int isUeventMonitorActive (void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_UEVENT */
@@ -35,6 +35,11 @@ extern "C" {
 
 #define UNICODE_BRAILLE_ROW 0X2800
 
+#define UNICODE_HANGUL_SYLLABLE_FIRST 0XAC00
+#define UNICODE_HANGUL_SYLLABLE_LAST 0XD7A3
+#define UNICODE_HANGUL_CHOSEONG_FIRST 0X1100
+#define UNICODE_HANGUL_SYLLABLES_PER_CHOSEONG (21 * 28)
+
 #define UNICODE_SURROGATE_BEGIN 0XD800
 #define UNICODE_SURROGATE_END 0XDFFF
 #define UNICODE_SURROGATE_SHIFT 10
@@ -80,6 +85,7 @@ extern int getCharacterAlias (wchar_t character, char *buffer, size_t size);
 extern int getCharacterByAlias (wchar_t *character, const char *alias);
 
 extern int getCharacterWidth (wchar_t character);
+extern int computeCharacterWidth (wchar_t character);
 
 extern int isBrailleCharacter (wchar_t character);
 extern int isIdeographicCharacter (wchar_t character);
@@ -91,6 +97,19 @@ extern int normalizeCharacters (
   wchar_t *buffer, unsigned int *map
 );
 
+static inline int
+isHangulSyllable (wchar_t character) {
+  return (character >= UNICODE_HANGUL_SYLLABLE_FIRST) &&
+         (character <= UNICODE_HANGUL_SYLLABLE_LAST);
+}
+
+static inline wchar_t
+getHangulSyllableBase (wchar_t syllable) {
+  /* the leading consonant (choseong) of a precomposed syllable */
+  return UNICODE_HANGUL_CHOSEONG_FIRST +
+         ((syllable - UNICODE_HANGUL_SYLLABLE_FIRST) / UNICODE_HANGUL_SYLLABLES_PER_CHOSEONG);
+}
+
 extern wchar_t getBaseCharacter (wchar_t character);
 extern wchar_t getTransliteratedCharacter (wchar_t character);
 
@@ -99,6 +99,7 @@ struct ActivityObjectStruct {
 
   ActivityState state;
   AsyncHandle startAlarm;
+  int retryInterval;
 };
 
 static const char *
@@ -215,7 +216,7 @@ prepareActivity (ActivityObject *activity) {
 static int
 scheduleActivity (ActivityObject *activity) {
   if (asyncNewRelativeAlarm(&activity->startAlarm, 0, handleActivityStartAlarm, activity)) {
-    if (asyncResetAlarmInterval(activity->startAlarm, activity->methods->retryInterval)) {
+    if (asyncResetAlarmInterval(activity->startAlarm, activity->retryInterval)) {
       setActivityState(activity, ACT_SCHEDULED);
       return 1;
     }
@@ -344,6 +345,7 @@ newActivity (const ActivityMethods *methods, void *data) {
 
     activity->state = ACT_STOPPED;
     activity->startAlarm = NULL;
+    activity->retryInterval = methods->retryInterval;
 
     return activity;
   } else {
@@ -360,6 +362,19 @@ destroyActivity (ActivityObject *activity) {
   free(activity);
 }
 
+void
+setActivityRetryInterval (ActivityObject *activity, int interval) {
+  if (!interval) interval = activity->methods->retryInterval;
+
+  if (interval != activity->retryInterval) {
+    logMessage(LOG_DEBUG, "activity retry interval: %s: %d",
+               activity->methods->activityName, interval);
+
+    activity->retryInterval = interval;
+    if (activity->startAlarm) asyncResetAlarmInterval(activity->startAlarm, interval);
+  }
+}
+
 int
 isActivityStarted (const ActivityObject *activity) {
   return activity->state == ACT_STARTED;
@@ -46,6 +46,8 @@ extern void destroyActivity (ActivityObject *activity);
 extern void startActivity (ActivityObject *activity);
 extern void stopActivity (ActivityObject *activity);
 
+extern void setActivityRetryInterval (ActivityObject *activity, int interval);
+
 extern int isActivityStarted (const ActivityObject *activity);
 extern int isActivityStopped (const ActivityObject *activity);
 
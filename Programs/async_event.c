@@ -20,12 +20,219 @@
 
 #include <string.h>
 
+#if defined(HAVE_SYS_EVENTFD_H) && defined(HAVE_SYNC_BOOL_COMPARE_AND_SWAP)
+#define ASYNC_EVENT_MAILBOX
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#endif /* mailbox support */
+
 #include "log.h"
+#include "parameters.h"
 #include "async_io.h"
 #include "async_event.h"
 #include "async_internal.h"
 #include "file.h"
 
+#ifdef ASYNC_EVENT_MAILBOX
+/* A bounded multiple-producer single-consumer queue of signal data.
+ * Any thread (or signal handler) may post to it, and only the thread which
+ * owns the event drains it. The eventfd is a doorbell which is only rung
+ * when the consumer isn't already known to have a wakeup pending.
+ */
+
+typedef struct {
+  volatile unsigned int sequence;
+  void *data;
+} AsyncEventMailboxSlot;
+
+struct AsyncEventStruct {
+  AsyncEventCallback *callback;
+  void *data;
+
+  FileDescriptor doorbell;
+  AsyncHandle monitorHandle;
+
+  volatile int doorbellRung;
+  unsigned draining:1;
+  unsigned discarded:1;
+
+  struct {
+    volatile unsigned int head;
+    unsigned int tail;
+
+    unsigned int size;
+    AsyncEventMailboxSlot slots[];
+  } mailbox;
+};
+
+static int
+postMailboxData (AsyncEvent *event, void *data) {
+  unsigned int position = event->mailbox.head;
+  AsyncEventMailboxSlot *slot;
+
+  while (1) {
+    slot = &event->mailbox.slots[position & (event->mailbox.size - 1)];
+    int difference = slot->sequence - position;
+
+    if (difference == 0) {
+      if (__sync_bool_compare_and_swap(&event->mailbox.head, position, position+1)) break;
+    } else if (difference < 0) {
+      return 0;
+    }
+
+    position = event->mailbox.head;
+  }
+
+  slot->data = data;
+  __sync_synchronize();
+  slot->sequence = position + 1;
+  return 1;
+}
+
+static int
+takeMailboxData (AsyncEvent *event, void **data) {
+  unsigned int position = event->mailbox.tail;
+  AsyncEventMailboxSlot *slot = &event->mailbox.slots[position & (event->mailbox.size - 1)];
+
+  if ((int)(slot->sequence - (position + 1)) < 0) return 0;
+  __sync_synchronize();
+  *data = slot->data;
+
+  __sync_synchronize();
+  slot->sequence = position + event->mailbox.size;
+  event->mailbox.tail = position + 1;
+  return 1;
+}
+
+static void
+deallocateEvent (AsyncEvent *event) {
+  closeFileDescriptor(event->doorbell);
+  logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event removed");
+  free(event);
+}
+
+ASYNC_MONITOR_CALLBACK(asyncMonitorEventDoorbell) {
+  AsyncEvent *event = parameters->data;
+
+  {
+    eventfd_t count;
+
+    if (eventfd_read(event->doorbell, &count) == -1) {
+      if (errno != EAGAIN) {
+        logSystemError("eventfd_read");
+        return 0;
+      }
+    }
+  }
+
+  /* Producers which post after this point will ring the doorbell again. */
+  event->doorbellRung = 0;
+  __sync_synchronize();
+
+  unsigned int count = 0;
+  void *data;
+  event->draining = 1;
+
+  while (!event->discarded && takeMailboxData(event, &data)) {
+    AsyncEventCallback *callback = event->callback;
+
+    const AsyncEventCallbackParameters parameters = {
+      .eventData = event->data,
+      .signalData = data
+    };
+
+    logSymbol(LOG_CATEGORY(ASYNC_EVENTS), callback, "event starting");
+    if (callback) callback(&parameters);
+    count += 1;
+  }
+
+  event->draining = 0;
+
+  if (event->discarded) {
+    deallocateEvent(event);
+    return 0;
+  }
+
+  logMessage(LOG_CATEGORY(ASYNC_EVENTS), "event signals drained: %u", count);
+  return 1;
+}
+
+int
+asyncSignalEvent (AsyncEvent *event, void *data) {
+  if (!postMailboxData(event, data)) {
+    logMessage(LOG_ERR, "event mailbox full");
+    return 0;
+  }
+
+  if (__sync_bool_compare_and_swap(&event->doorbellRung, 0, 1)) {
+    if (eventfd_write(event->doorbell, 1) == -1) {
+      /* The data has been posted so it mustn't be reclaimed by the caller.
+       * It'll be delivered the next time the doorbell is rung.
+       */
+      logSystemError("eventfd_write");
+      event->doorbellRung = 0;
+    }
+  }
+
+  return 1;
+}
+
+/* The limit is the number of signals which may be pending at once. It's
+ * rounded up to a power of two (of at least two because a slot's sequence
+ * can't otherwise tell full from empty), and sizes the mailbox so that an
+ * event which is only ever signalled once doesn't carry a full size one.
+ */
+AsyncEvent *
+asyncNewLimitedEvent (AsyncEventCallback *callback, void *data, unsigned int limit) {
+  unsigned int size = 2;
+  while (size < limit) size <<= 1;
+
+  AsyncEvent *event;
+  size_t eventSize = sizeof(*event) + (size * sizeof(event->mailbox.slots[0]));
+
+  if ((event = malloc(eventSize))) {
+    memset(event, 0, eventSize);
+    event->callback = callback;
+    event->data = data;
+
+    event->mailbox.size = size;
+    for (unsigned int index=0; index<size; index+=1) {
+      event->mailbox.slots[index].sequence = index;
+    }
+
+    if ((event->doorbell = eventfd(0, (EFD_CLOEXEC | EFD_NONBLOCK))) != -1) {
+      if (asyncMonitorFileInput(&event->monitorHandle, event->doorbell,
+                                asyncMonitorEventDoorbell, event)) {
+        logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event added");
+        return event;
+      }
+
+      closeFileDescriptor(event->doorbell);
+    } else {
+      logSystemError("eventfd");
+    }
+
+    free(event);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+void
+asyncDiscardEvent (AsyncEvent *event) {
+  asyncCancelRequest(event->monitorHandle);
+
+  if (event->draining) {
+    event->discarded = 1;
+  } else {
+    deallocateEvent(event);
+  }
+}
+
+#else /* ASYNC_EVENT_MAILBOX */
 struct AsyncEventStruct {
   AsyncEventCallback *callback;
   void *data;
@@ -97,7 +304,7 @@ asyncSignalEvent (AsyncEvent *event, void *data) {
 }
 
 AsyncEvent *
-asyncNewEvent (AsyncEventCallback *callback, void *data) {
+asyncNewLimitedEvent (AsyncEventCallback *callback, void *data, unsigned int limit) {
   AsyncEvent *event;
 
   if ((event = malloc(sizeof(*event)))) {
@@ -157,4 +364,9 @@ asyncDiscardEvent (AsyncEvent *event) {
   logSymbol(LOG_CATEGORY(ASYNC_EVENTS), event->callback, "event removed");
   free(event);
 }
+#endif /* ASYNC_EVENT_MAILBOX */
 
+AsyncEvent *
+asyncNewEvent (AsyncEventCallback *callback, void *data) {
+  return asyncNewLimitedEvent(callback, data, ASYNC_EVENT_MAILBOX_SIZE);
+}
@@ -564,13 +564,32 @@ deallocateFunctionEntry (void *item, void *data) {
   free(function);
 }
 
+static ItemKey
+makeFunctionKey (FileDescriptor fileDescriptor) {
+  return (uintptr_t)fileDescriptor;
+}
+
+static ItemKey
+makeFunctionEntryKey (const void *item, void *queueData) {
+  const FunctionEntry *function = item;
+  return makeFunctionKey(function->fileDescriptor);
+}
+
 static Queue *
 getFunctionQueue (int create) {
   AsyncIoData *iod = getIoData();
   if (!iod) return NULL;
 
   if (!iod->functionQueue && create) {
-    iod->functionQueue = newQueue(deallocateFunctionEntry, NULL);
+    Queue *functions = newQueue(deallocateFunctionEntry, NULL);
+
+    if (functions) {
+      if (setQueueKeyMaker(functions, makeFunctionEntryKey)) {
+        iod->functionQueue = functions;
+      } else {
+        deallocateQueue(functions);
+      }
+    }
   }
 
   return iod->functionQueue;
@@ -847,7 +866,8 @@ getFunctionElement (FileDescriptor fileDescriptor, const FunctionMethods *method
       };
 
       {
-        Element *element = findElement(functions, testFunctionEntry, &key);
+        Element *element = findElementWithKey(functions, makeFunctionKey(fileDescriptor),
+                                              testFunctionEntry, &key);
         if (element) return element;
       }
     }
@@ -29,6 +29,8 @@
 #include "parse.h"
 #include "device.h"
 #include "queue.h"
+#include "file.h"
+#include "datafile.h"
 #include "io_bluetooth.h"
 #include "bluetooth_internal.h"
 
@@ -64,6 +66,17 @@ typedef struct {
   char *name;
   int error;
   unsigned paired:1;
+
+  uint8_t channel;
+  char *driver;
+  const char **driverCodes;
+
+  struct {
+    int32_t name;
+    int32_t channel;
+    int32_t driver;
+    int32_t error;
+  } cached;
 } BluetoothDeviceEntry;
 
 static void
@@ -71,12 +84,29 @@ bthDeallocateDeviceEntry (void *item, void *data) {
   BluetoothDeviceEntry *device = item;
 
   if (device->name) free(device->name);
+  if (device->driver) free(device->driver);
+  if (device->driverCodes) free(device->driverCodes);
   free(device);
 }
 
+static void bthLoadDeviceCache (Queue *devices);
+
+static ItemKey
+bthMakeDeviceKey (const void *item, void *queueData) {
+  const BluetoothDeviceEntry *device = item;
+  return device->address;
+}
+
 static Queue *
 bthCreateDeviceQueue (void *data) {
-  return newQueue(bthDeallocateDeviceEntry, NULL);
+  Queue *devices = newQueue(bthDeallocateDeviceEntry, NULL);
+
+  if (devices) {
+    setQueueKeyMaker(devices, bthMakeDeviceKey);
+    bthLoadDeviceCache(devices);
+  }
+
+  return devices;
 }
 
 static Queue *
@@ -95,27 +125,35 @@ bthTestDeviceAddress (const void *item, void *data) {
   return device->address == *address;
 }
 
+static BluetoothDeviceEntry *
+bthAddDeviceEntry (Queue *devices, uint64_t address) {
+  BluetoothDeviceEntry *device;
+
+  if ((device = malloc(sizeof(*device)))) {
+    memset(device, 0, sizeof(*device));
+    device->address = address;
+    device->name = NULL;
+    device->driver = NULL;
+    device->driverCodes = NULL;
+
+    if (enqueueItem(devices, device)) return device;
+    free(device);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
 static BluetoothDeviceEntry *
 bthGetDeviceEntry (uint64_t address, int add) {
-  Queue *devices = bthGetDeviceQueue(add);
+  /* creating the queue loads the device cache */
+  Queue *devices = bthGetDeviceQueue(1);
 
   if (devices) {
-    BluetoothDeviceEntry *device = findItem(devices, bthTestDeviceAddress, &address);
+    BluetoothDeviceEntry *device = findItemWithKey(devices, address, bthTestDeviceAddress, &address);
     if (device) return device;
-
-    if (add) {
-      if ((device = malloc(sizeof(*device)))) {
-        device->address = address;
-        device->name = NULL;
-        device->error = 0;
-        device->paired = 0;
-
-        if (enqueueItem(devices, device)) return device;
-        free(device);
-      } else {
-        logMallocError();
-      }
-    }
+    if (add) return bthAddDeviceEntry(devices, address);
   }
 
   return NULL;
@@ -138,6 +176,195 @@ bthSetDeviceName (BluetoothDeviceEntry *device, const char *name) {
   return 0;
 }
 
+static int
+bthSetDeviceDriver (BluetoothDeviceEntry *device, const char *driver) {
+  if (device->driver && (strcmp(device->driver, driver) == 0)) return 1;
+
+  {
+    char *copy = strdup(driver);
+
+    if (!copy) {
+      logMallocError();
+      return 0;
+    }
+
+    if (device->driver) free(device->driver);
+    device->driver = copy;
+  }
+
+  return 1;
+}
+
+/* The device cache remembers what's slow to find out about a device
+ * (its name, its serial port channel, and which driver worked with it)
+ * across restarts. Each line describes one device:
+ *
+ *   address name-time channel channel-time driver-time driver name
+ *
+ * A time of zero means that the field isn't set. Fields are dropped
+ * when they're loaded if they've become too old to be trusted. The file
+ * is only rewritten when what it says about a device changes, or when a
+ * field that's still in use needs a newer time.
+ *
+ * Connect errors are short-lived so they're only remembered in memory.
+ */
+
+static const char bthDeviceCacheFile[] = "bluetooth-devices";
+
+static int32_t
+bthGetCacheTime (void) {
+  TimeValue now;
+  getCurrentTime(&now);
+  return now.seconds;
+}
+
+static int
+bthIsCacheTimeCurrent (int32_t time, int32_t now, int32_t lifetime) {
+  if (!time) return 0;
+  if (time > now) return 0;
+  return (now - time) < lifetime;
+}
+
+static int
+bthIsCacheTimeStale (int32_t time, int32_t now) {
+  return (now - time) >= BLUETOOTH_CACHE_REFRESH_SECONDS;
+}
+
+static int
+bthLoadDeviceCacheLine (const LineHandlerParameters *parameters) {
+  Queue *devices = parameters->data;
+  const char *line = parameters->line.text;
+  int32_t now = bthGetCacheTime();
+
+  uint64_t address;
+  int32_t nameTime;
+  unsigned int channel;
+  int32_t channelTime;
+  int32_t driverTime;
+  char driver[0X20];
+  int length;
+
+  int count = sscanf(line,
+    "%" SCNx64 " %" SCNi32 " %u %" SCNi32 " %" SCNi32 " %31s %n",
+    &address, &nameTime, &channel, &channelTime, &driverTime, driver,
+    &length
+  );
+
+  if (count < 6) {
+    logMessage(LOG_WARNING, "invalid Bluetooth device cache line: %u",
+               parameters->line.number);
+    return 1;
+  }
+
+  if (findItemWithKey(devices, address, bthTestDeviceAddress, &address)) return 1;
+  BluetoothDeviceEntry *device = bthAddDeviceEntry(devices, address);
+  if (!device) return 0;
+
+  if (bthIsCacheTimeCurrent(nameTime, now, BLUETOOTH_CACHE_NAME_SECONDS)) {
+    if (bthSetDeviceName(device, &line[length])) device->cached.name = nameTime;
+  }
+
+  if (bthIsCacheTimeCurrent(channelTime, now, BLUETOOTH_CACHE_CHANNEL_SECONDS)) {
+    if ((channel > 0) && (channel < 0X1F)) {
+      device->channel = channel;
+      device->cached.channel = channelTime;
+    }
+  }
+
+  if (bthIsCacheTimeCurrent(driverTime, now, BLUETOOTH_CACHE_DRIVER_SECONDS)) {
+    if (bthSetDeviceDriver(device, driver)) device->cached.driver = driverTime;
+  }
+
+  logMessage(LOG_CATEGORY(BLUETOOTH_IO),
+             "cached device: Addr:%012" PRIX64 " Chan:%u Drv:%s Name:%s",
+             device->address, device->channel,
+             device->driver? device->driver: "", device->name? device->name: "");
+
+  return 1;
+}
+
+static void
+bthLoadDeviceCache (Queue *devices) {
+  char *path = makeUpdatablePath(bthDeviceCacheFile);
+
+  if (path) {
+    FILE *stream = openDataFile(path, "r", 1);
+
+    if (stream) {
+      processLines(stream, bthLoadDeviceCacheLine, devices);
+      fclose(stream);
+    }
+
+    free(path);
+  }
+}
+
+static int
+bthSaveDeviceCacheEntry (void *item, void *data) {
+  const BluetoothDeviceEntry *device = item;
+  FILE *stream = data;
+
+  int haveName = device->name && device->cached.name;
+  int haveDriver = device->driver && device->cached.driver;
+
+  if (!(haveName || device->cached.channel || haveDriver)) return 0;
+
+  fprintf(stream,
+    "%012" PRIX64 " %" PRIi32 " %u %" PRIi32 " %" PRIi32 " %s %s\n",
+    device->address,
+    haveName? device->cached.name: 0,
+    device->channel, device->cached.channel,
+    haveDriver? device->cached.driver: 0,
+    haveDriver? device->driver: "-",
+    haveName? device->name: ""
+  );
+
+  return ferror(stream);
+}
+
+static void
+bthSaveDeviceCache (void) {
+  Queue *devices = bthGetDeviceQueue(0);
+  if (!devices) return;
+
+  char *path = makeUpdatablePath(bthDeviceCacheFile);
+  if (!path) return;
+
+  {
+    /* write a new file and then rename it so that a crash or a power loss
+     * can't leave a truncated cache behind */
+    char newPath[strlen(path) + 5];
+    snprintf(newPath, sizeof(newPath), "%s.new", path);
+
+    FILE *stream = openDataFile(newPath, "w", 1);
+
+    if (stream) {
+      int ok = 1;
+
+      if (processQueue(devices, bthSaveDeviceCacheEntry, stream)) {
+        logSystemError("fprintf");
+        ok = 0;
+      }
+
+      if (fclose(stream) == EOF) {
+        logSystemError("fclose");
+        ok = 0;
+      }
+
+      if (ok) {
+        if (rename(newPath, path) == -1) {
+          logSystemError("rename");
+          ok = 0;
+        }
+      }
+
+      if (!ok) unlink(newPath);
+    }
+  }
+
+  free(path);
+}
+
 static inline const char *
 bthGetPairedKeyword (int state) {
   return getFlagKeywordYesNo(state);
@@ -174,9 +401,9 @@ bthDiscoverDevices (void) {
 
 void
 bthForgetDevices (void) {
-  Queue *devices = bthGetDeviceQueue(0);
-
-  if (devices) deleteElements(devices);
+  /* The device entries are kept since they're also the cache. Discovery
+   * is redone, and a remembered connect error lasts until it expires.
+   */
   bluetoothDevicesDiscovered = 0;
 }
 
@@ -186,6 +413,7 @@ bthRememberConnectError (uint64_t address, int value) {
   if (!device) return 0;
 
   device->error = value;
+  device->cached.error = bthGetCacheTime();
   return 1;
 }
 
@@ -195,12 +423,87 @@ bthRecallConnectError (uint64_t address, int *value) {
   if (!device) return 0;
   if (!device->error) return 0;
 
+  if (!bthIsCacheTimeCurrent(device->cached.error, bthGetCacheTime(),
+                             BLUETOOTH_CACHE_ERROR_SECONDS)) {
+    device->error = 0;
+    device->cached.error = 0;
+    return 0;
+  }
+
   *value = device->error;
   return 1;
 }
 
+static int
+bthRecallChannel (uint64_t address, uint8_t *channel) {
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+  if (!device) return 0;
+  if (!device->cached.channel) return 0;
+
+  *channel = device->channel;
+  return 1;
+}
+
+static void
+bthRememberConnection (uint64_t address, uint8_t channel, const char *driver) {
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 1);
+
+  if (device) {
+    int32_t now = bthGetCacheTime();
+    int changed = 0;
+
+    device->error = 0;
+    device->cached.error = 0;
+
+    if ((channel != device->channel) || bthIsCacheTimeStale(device->cached.channel, now)) {
+      device->channel = channel;
+      device->cached.channel = now;
+      changed = 1;
+    }
+
+    if (driver && *driver) {
+      if (!device->driver || (strcmp(driver, device->driver) != 0) ||
+          bthIsCacheTimeStale(device->cached.driver, now)) {
+        if (bthSetDeviceDriver(device, driver)) {
+          device->cached.driver = now;
+          changed = 1;
+        }
+      }
+    }
+
+    if (changed) bthSaveDeviceCache();
+  }
+}
+
+static int
+bthConnectChannel (BluetoothConnection *connection, int timeout) {
+  TimePeriod period;
+  startTimePeriod(&period, BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT);
+
+  while (1) {
+    if (bthOpenChannel(connection->extension, connection->channel, timeout)) return 1;
+    if (afterTimePeriod(&period, NULL)) break;
+    if (errno != EBUSY) break;
+    asyncWait(BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL);
+  }
+
+  return 0;
+}
+
+static int
+bthIsDeviceUnreachable (int error) {
+  switch (error) {
+    case EHOSTUNREACH:
+    case EHOSTDOWN:
+      return 1;
+
+    default:
+      return 0;
+  }
+}
+
 static BluetoothConnection *
-bthNewConnection (uint64_t address, uint8_t channel, int discover, int timeout) {
+bthNewConnection (uint64_t address, uint8_t channel, int discover, int timeout, const char *driver) {
   BluetoothConnection *connection;
 
   if ((connection = malloc(sizeof(*connection)))) {
@@ -211,9 +514,6 @@ bthNewConnection (uint64_t address, uint8_t channel, int discover, int timeout)
     if ((connection->extension = bthNewConnectionExtension(connection->address))) {
       int alreadyTried = 0;
 
-      if (discover) bthDiscoverSerialPortChannel(&connection->channel, connection->extension, timeout);
-      bthLogChannel(connection->channel);
-
       {
         int value;
 
@@ -224,20 +524,35 @@ bthNewConnection (uint64_t address, uint8_t channel, int discover, int timeout)
       }
 
       if (!alreadyTried) {
-        TimePeriod period;
-        startTimePeriod(&period, BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT);
-
-        while (1) {
-          if (bthOpenChannel(connection->extension, connection->channel, timeout)) {
-            return connection;
+        int cachedChannel = 0;
+
+        if (discover) {
+          if (bthRecallChannel(connection->address, &connection->channel)) {
+            logMessage(LOG_CATEGORY(BLUETOOTH_IO), "using cached channel");
+            cachedChannel = 1;
+          } else {
+            bthDiscoverSerialPortChannel(&connection->channel, connection->extension, timeout);
           }
+        }
+
+        bthLogChannel(connection->channel);
+        if (bthConnectChannel(connection, timeout)) goto connected;
+        int error = errno;
 
-          if (afterTimePeriod(&period, NULL)) break;
-          if (errno != EBUSY) break;
-          asyncWait(BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL);
+        if (cachedChannel && !bthIsDeviceUnreachable(error)) {
+          uint8_t oldChannel = connection->channel;
+
+          if (bthDiscoverSerialPortChannel(&connection->channel, connection->extension, timeout)) {
+            if (connection->channel != oldChannel) {
+              bthLogChannel(connection->channel);
+              if (bthConnectChannel(connection, timeout)) goto connected;
+              error = errno;
+            }
+          }
         }
 
-        bthRememberConnectError(connection->address, errno);
+        bthRememberConnectError(connection->address, error);
+        errno = error;
       }
 
       bthReleaseConnectionExtension(connection->extension);
@@ -249,6 +564,10 @@ bthNewConnection (uint64_t address, uint8_t channel, int discover, int timeout)
   }
 
   return NULL;
+
+connected:
+  bthRememberConnection(connection->address, connection->channel, driver);
+  return connection;
 }
 
 void
@@ -552,7 +871,7 @@ bthOpenConnection (const BluetoothConnectionRequest *request) {
       uint64_t address;
       if (!bthGetDeviceAddress(&address, parameters, req.driver)) ok = 0;
 
-      if (ok) connection = bthNewConnection(address, req.channel, req.discover, req.timeout);
+      if (ok) connection = bthNewConnection(address, req.channel, req.discover, req.timeout, req.driver);
     }
 
     deallocateStrings(parameters);
@@ -648,6 +967,8 @@ bthGetDeviceName (uint64_t address, int timeout) {
 
       if ((device->name = bthObtainDeviceName(address, timeout))) {
         logMessage(LOG_CATEGORY(BLUETOOTH_IO), "device name: %s", device->name);
+        device->cached.name = bthGetCacheTime();
+        bthSaveDeviceCache();
       } else {
         logMessage(LOG_CATEGORY(BLUETOOTH_IO), "device name not obtained");
       }
@@ -770,6 +1091,43 @@ failure:
   return noDriverCodes;
 }
 
+static const char *const *
+bthGetDeviceDriverCodes (BluetoothDeviceEntry *device, const char *const *codes) {
+  if (!device->driver) return codes;
+
+  /* try the driver which worked last time first */
+  unsigned int count = 0;
+  int found = 0;
+
+  while (codes[count]) {
+    if (strcmp(codes[count], device->driver) == 0) found = 1;
+    count += 1;
+  }
+
+  if (!found) return codes;
+
+  /* the previous list is no longer in use by the time this is called again */
+  const char **newCodes = realloc(device->driverCodes, ARRAY_SIZE(newCodes, count+1));
+
+  if (!newCodes) {
+    logMallocError();
+    return codes;
+  }
+
+  device->driverCodes = newCodes;
+
+  for (unsigned int index=0; index<count; index+=1) {
+    if (strcmp(codes[index], device->driver) == 0) *newCodes++ = codes[index];
+  }
+
+  for (unsigned int index=0; index<count; index+=1) {
+    if (strcmp(codes[index], device->driver) != 0) *newCodes++ = codes[index];
+  }
+
+  *newCodes = NULL;
+  return device->driverCodes;
+}
+
 const char *const *
 bthGetDriverCodes (const char *identifier, int timeout) {
   const char *const *codes = NULL;
@@ -781,7 +1139,13 @@ bthGetDriverCodes (const char *identifier, int timeout) {
     if (bthGetDeviceAddress(&address, parameters, NULL)) {
       const char *name = bthGetDeviceName(address, timeout);
       const BluetoothNameEntry *entry = bthGetNameEntry(name);
-      if (entry) codes = entry->driverCodes;
+
+      if (entry) {
+        codes = entry->driverCodes;
+
+        BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+        if (device) codes = bthGetDeviceDriverCodes(device, codes);
+      }
     }
 
     deallocateStrings(parameters);
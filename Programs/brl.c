@@ -28,6 +28,7 @@
 #include "charset.h"
 #include "unicode.h"
 #include "brl.h"
+#include "brl_utils.h"
 #include "ttb.h"
 #include "ktb.h"
 #include "queue.h"
@@ -76,10 +77,20 @@ constructBrailleDisplay (BrailleDisplay *brl) {
   brl->acknowledgements.missing.timeout = BRAILLE_MESSAGE_ACKNOWLEDGEMENT_TIMEOUT;
   brl->acknowledgements.missing.count = 0;
   brl->acknowledgements.missing.limit = BRAILLE_MESSAGE_UNACKNOWLEDGEED_LIMIT;
+  brl->acknowledgements.pending.size = 0;
+
+  getMonotonicTime(&brl->pacing.busyUntil);
+  brl->pacing.acknowledgementLatency = 0;
+  brl->pacing.frames.written = 0;
+  brl->pacing.frames.dropped = 0;
+  brl->pacing.frames.latency = 0;
+  brl->pacing.frames.isPending = 0;
 }
 
 void
 destructBrailleDisplay (BrailleDisplay *brl) {
+  logBrailleOutputStatistics(brl);
+
   if (brl->acknowledgements.alarm) {
     asyncCancelRequest(brl->acknowledgements.alarm);
     brl->acknowledgements.alarm = NULL;
@@ -26,6 +26,8 @@
 #include "api_control.h"
 #include "queue.h"
 #include "async_alarm.h"
+#include "timing.h"
+#include "latency.h"
 #include "brl_base.h"
 #include "brl_utils.h"
 #include "brl_dots.h"
@@ -192,16 +194,22 @@ readBraillePacket (
   size_t length = 1;
   int started = 0;
 
+  /* a resource (e.g. replay) may want to know what parsing each packet costs */
+  int timing = gioIsNotingInputPackets(endpoint);
+  TimeValue firstByte;
+
   while (1) {
     unsigned char byte;
 
     if (!gioReadByte(endpoint, &byte, started)) {
       if (count > 0) logPartialPacket(bytes, count);
+      setLatencyOrigin(0);
       return 0;
     }
 
   gotByte:
     if (count < size) {
+      if (timing && !count) getMonotonicTime(&firstByte);
       bytes[count++] = byte;
       BraillePacketVerifierResult result = verifyPacket(brl, bytes, count, &length, data);
 
@@ -235,7 +243,18 @@ readBraillePacket (
       }
 
       if (count >= length) {
+        if (timing) {
+          TimeValue now;
+          getMonotonicTime(&now);
+
+          gioNoteInputPacket(endpoint, length,
+            ((unsigned long int)(now.seconds - firstByte.seconds) * NSECS_PER_SEC) +
+            (now.nanoseconds - firstByte.nanoseconds)
+          );
+        }
+
         logInputPacket(bytes, length);
+        setLatencyOrigin(1);
         return length;
       }
     } else {
@@ -255,12 +274,46 @@ writeBraillePacket (
   if (gioWriteData(endpoint, packet, size) == -1) return 0;
 
   if (endpoint == brl->gioEndpoint) {
-    brl->writeDelay += gioGetMillisecondsToTransfer(endpoint, size);
+    unsigned int delay = gioGetMillisecondsToTransfer(endpoint, size);
+    brl->writeDelay += delay;
+
+    {
+      TimeValue now;
+      getMonotonicTime(&now);
+
+      if (compareTimeValues(&brl->pacing.busyUntil, &now) < 0) {
+        brl->pacing.busyUntil = now;
+      }
+
+      adjustTimeValue(&brl->pacing.busyUntil, delay);
+    }
   }
 
   return 1;
 }
 
+static void
+startBrailleAcknowledgement (BrailleDisplay *brl, size_t size) {
+  getMonotonicTime(&brl->acknowledgements.pending.time);
+  brl->acknowledgements.pending.size = size;
+}
+
+static void
+endBrailleAcknowledgement (BrailleDisplay *brl) {
+  if (brl->acknowledgements.pending.size) {
+    long int elapsed = getMonotonicElapsed(&brl->acknowledgements.pending.time);
+
+    brl->acknowledgements.pending.size = 0;
+    smoothBrailleMeasurement(&brl->pacing.acknowledgementLatency, elapsed);
+
+    logMessage(LOG_CATEGORY(OUTPUT_PACKETS),
+               "acknowledgement latency: %ldms (average %dms)",
+               elapsed, brl->pacing.acknowledgementLatency);
+
+    getMonotonicTime(&brl->pacing.busyUntil);
+  }
+}
+
 typedef struct {
   GioEndpoint *endpoint;
   int type;
@@ -292,6 +345,7 @@ writeNextBrailleMessage (BrailleDisplay *brl) {
 
       logBrailleMessage(msg, "dequeued");
       written = writeBraillePacket(brl, msg->endpoint, msg->packet, msg->size);
+      if (written) startBrailleAcknowledgement(brl, msg->size);
 
       deallocateBrailleMessage(msg);
       msg = NULL;
@@ -310,6 +364,7 @@ writeNextBrailleMessage (BrailleDisplay *brl) {
     brl->acknowledgements.alarm = NULL;
   }
 
+  if (brl->pacing.frames.isPending) report(REPORT_BRAILLE_OUTPUT_READY, NULL);
   return ok;
 }
 
@@ -317,6 +372,7 @@ int
 acknowledgeBrailleMessage (BrailleDisplay *brl) {
   logMessage(LOG_CATEGORY(OUTPUT_PACKETS), "acknowledged");
   brl->acknowledgements.missing.count = 0;
+  endBrailleAcknowledgement(brl);
   return writeNextBrailleMessage(brl);
 }
 
@@ -326,6 +382,8 @@ ASYNC_ALARM_CALLBACK(handleBrailleMessageTimeout) {
   asyncDiscardHandle(brl->acknowledgements.alarm);
   brl->acknowledgements.alarm = NULL;
 
+  brl->acknowledgements.pending.size = 0;
+
   if ((brl->acknowledgements.missing.count += 1) < brl->acknowledgements.missing.limit) {
     logMessage(LOG_WARNING, "missing braille message acknowledgement");
     writeNextBrailleMessage(brl);
@@ -402,6 +460,7 @@ writeBrailleMessage (
       logMallocError();
     }
   } else if (writeBraillePacket(brl, endpoint, packet, size)) {
+    startBrailleAcknowledgement(brl, size);
     setBrailleMessageAlarm(brl);
     return 1;
   }
@@ -619,7 +678,9 @@ enqueueKeyEvent (
   if (api.handleKeyEvent(group, number, press)) return 1;
 
   if (brl->keyTable) {
+    beginLatencyTrace();
     processKeyEvent(brl->keyTable, getCurrentCommandContext(), group, number, press);
+    setLatencyTrace(0);
     return 1;
   }
 
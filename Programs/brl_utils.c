@@ -26,6 +26,7 @@
 #include "brl_utils.h"
 #include "brl_dots.h"
 #include "async_wait.h"
+#include "timing.h"
 #include "ktb.h"
 
 void
@@ -37,6 +38,103 @@ drainBrailleOutput (BrailleDisplay *brl, int minimumDelay) {
   asyncWait(duration);
 }
 
+void
+smoothBrailleMeasurement (int *average, int sample) {
+  *average = *average? (((*average * 3) + sample) / 4): sample;
+}
+
+int
+getBrailleOutputBusyTime (BrailleDisplay *brl) {
+  /* an outstanding acknowledgement isn't timed - it ends with a report */
+  if (brl->acknowledgements.alarm) return 0;
+
+  {
+    TimeValue now;
+    long int remaining;
+
+    getMonotonicTime(&now);
+    remaining = millisecondsBetween(&now, &brl->pacing.busyUntil);
+    if (remaining > 0) return remaining;
+  }
+
+  return 0;
+}
+
+static unsigned int
+getBrailleWindowChecksum (BrailleDisplay *brl) {
+  const unsigned char *cell = brl->buffer;
+  const unsigned char *end = cell + (brl->textColumns * brl->textRows);
+  unsigned int checksum = 0X811C9DC5;
+
+  while (cell < end) {
+    checksum ^= *cell++;
+    checksum *= 0X01000193;
+  }
+
+  return checksum;
+}
+
+/* a deferred window that's replaced by a different one was never shown */
+static void
+checkPendingBrailleWindow (BrailleDisplay *brl, unsigned int checksum) {
+  if (checksum != brl->pacing.frames.checksum) {
+    brl->pacing.frames.dropped += 1;
+  }
+}
+
+int
+deferBrailleWindow (BrailleDisplay *brl, int *delay) {
+  *delay = getBrailleOutputBusyTime(brl);
+  if (!*delay && !brl->acknowledgements.alarm) return 0;
+
+  {
+    unsigned int checksum = getBrailleWindowChecksum(brl);
+
+    if (brl->pacing.frames.isPending) {
+      checkPendingBrailleWindow(brl, checksum);
+    } else {
+      getMonotonicTime(&brl->pacing.frames.since);
+      brl->pacing.frames.isPending = 1;
+    }
+
+    brl->pacing.frames.checksum = checksum;
+  }
+
+  logMessage(LOG_CATEGORY(OUTPUT_PACKETS), "window deferred: %dms", *delay);
+  return 1;
+}
+
+void
+noteBrailleWindowWritten (BrailleDisplay *brl) {
+  long int latency = 0;
+
+  if (brl->pacing.frames.isPending) {
+    checkPendingBrailleWindow(brl, getBrailleWindowChecksum(brl));
+    latency = getMonotonicElapsed(&brl->pacing.frames.since);
+    brl->pacing.frames.isPending = 0;
+  }
+
+  latency += getBrailleOutputBusyTime(brl);
+  brl->pacing.frames.written += 1;
+  smoothBrailleMeasurement(&brl->pacing.frames.latency, latency);
+}
+
+void
+logBrailleOutputStatistics (BrailleDisplay *brl) {
+  if (brl->pacing.frames.written || brl->pacing.frames.dropped) {
+    logMessage(LOG_DEBUG,
+               "braille output: %u windows written, %u dropped, latency %dms",
+               brl->pacing.frames.written, brl->pacing.frames.dropped,
+               brl->pacing.frames.latency);
+  }
+
+  if (brl->pacing.acknowledgementLatency) {
+    logMessage(LOG_DEBUG,
+               "braille acknowledgements: latency %dms",
+               brl->pacing.acknowledgementLatency);
+  }
+}
+
 void
 announceBrailleOffline (void) {
   logMessage(LOG_DEBUG, "braille is offline");
@@ -72,6 +170,7 @@ setBrailleOnline (BrailleDisplay *brl) {
     announceBrailleOnline();
 
     brl->writeDelay = 0;
+    getMonotonicTime(&brl->pacing.busyUntil);
   }
 }
 
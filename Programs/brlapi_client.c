@@ -231,6 +231,9 @@ sem_destroy (sem_t *sem) {
 */
 #define BRL_KEYBUF_SIZE 256
 
+/* How many pipelined requests may await their acknowledgement at once */
+#define BRLAPI_REQUEST_PIPELINE_DEPTH 32
+
 struct brlapi_parameterCallback_t {
   brlapi_param_t parameter;
   brlapi_param_subparam_t subparam;
@@ -1493,31 +1496,38 @@ void* BRLAPI_STDCALL brlapi_getParameterAlloc(brlapi_param_t parameter, brlapi_p
   return brlapi__getParameterAlloc(&defaultHandle, parameter, subparam, flags, len);
 }
 
-/* Function: brlapi_setParameter */
-int BRLAPI_STDCALL brlapi__setParameter(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void* data, size_t len)
+/* Function: makeParameterPacket */
+/* Fills a parameter value packet, returns its size or -1 on error */
+static ssize_t makeParameterPacket(brlapi_paramValuePacket_t *packet, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void* data, size_t len)
 {
-  brlapi_paramValuePacket_t packet;
-  int res;
-
   if (flags & ~BRLAPI_PARAMF_GLOBAL) {
     brlapi_errno = BRLAPI_ERROR_INVALID_PARAMETER;
     return -1;
   }
 
-  if (len > sizeof(packet.data)) {
+  if (len > sizeof(packet->data)) {
     brlapi_errno = BRLAPI_ERROR_INVALID_PARAMETER;
     return -1;
   }
 
-  packet.flags = htonl(flags);
-  packet.param = htonl(parameter);
-  packet.subparam_hi = htonl(subparam >> 32);
-  packet.subparam_lo = htonl(subparam & 0xfffffffful);
-  memcpy(packet.data, data, len);
-  _brlapi_htonParameter(parameter, &packet, len);
+  packet->flags = htonl(flags);
+  packet->param = htonl(parameter);
+  packet->subparam_hi = htonl(subparam >> 32);
+  packet->subparam_lo = htonl(subparam & 0xfffffffful);
+  memcpy(packet->data, data, len);
+  _brlapi_htonParameter(parameter, packet, len);
 
-  res = brlapi__writePacketWaitForAck(handle, BRLAPI_PACKET_PARAM_VALUE, &packet, sizeof(packet.flags) + sizeof(parameter) + sizeof(subparam) + len);
-  return res;
+  return sizeof(packet->flags) + sizeof(parameter) + sizeof(subparam) + len;
+}
+
+/* Function: brlapi_setParameter */
+int BRLAPI_STDCALL brlapi__setParameter(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void* data, size_t len)
+{
+  brlapi_paramValuePacket_t packet;
+  ssize_t size = makeParameterPacket(&packet, parameter, subparam, flags, data, len);
+
+  if (size < 0) return -1;
+  return brlapi__writePacketWaitForAck(handle, BRLAPI_PACKET_PARAM_VALUE, &packet, size);
 }
 
 int BRLAPI_STDCALL brlapi_setParameter(brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void* data, size_t len)
@@ -2443,9 +2453,8 @@ done:
 /* Function : ignore_accept_key_range */
 /* Common tasks for ignoring and unignoring key ranges */
 /* what = 0 for ignoring !0 for unignoring */
-static int ignore_accept_key_ranges(brlapi_handle_t *handle, int what, const brlapi_range_t ranges[], unsigned int n)
+static void make_key_ranges(uint32_t ints[][4], const brlapi_range_t ranges[], unsigned int n)
 {
-  uint32_t ints[n][4];
   unsigned int i;
 
   for (i=0; i<n; i++) {
@@ -2454,7 +2463,13 @@ static int ignore_accept_key_ranges(brlapi_handle_t *handle, int what, const brl
     ints[i][2] = htonl(ranges[i].last >> 32);
     ints[i][3] = htonl(ranges[i].last & 0xffffffff);
   };
+}
 
+static int ignore_accept_key_ranges(brlapi_handle_t *handle, int what, const brlapi_range_t ranges[], unsigned int n)
+{
+  uint32_t ints[n][4];
+
+  make_key_ranges(ints, ranges, n);
   if (brlapi__writePacketWaitForAck(handle,(what ? BRLAPI_PACKET_ACCEPTKEYRANGES : BRLAPI_PACKET_IGNOREKEYRANGES),ints,n*2*sizeof(brlapi_keyCode_t)))
     return -1;
   return 0;
@@ -2535,6 +2550,170 @@ int BRLAPI_STDCALL brlapi_ignoreKeys(brlapi_rangeType_t r, const brlapi_keyCode_
   return brlapi__ignoreKeys(&defaultHandle, r, code, n);
 }
 
+/* Function : writeRequest */
+/* Sends one pipelined request without waiting for its acknowledgement */
+/* Returns 1 if it was sent, 0 if it was rejected locally (brlapi_errno says
+ * why), or -1 if the connection failed */
+static int writeRequest(brlapi_handle_t *handle, const brlapi_request_t *request)
+{
+  switch (request->type) {
+    case brlapi_request_acceptKeyRanges:
+    case brlapi_request_ignoreKeyRanges: {
+      unsigned int n = request->arguments.keyRanges.count;
+      uint32_t ints[n? n: 1][4];
+
+      make_key_ranges(ints, request->arguments.keyRanges.ranges, n);
+      if (brlapi_writePacket(handle->fileDescriptor,
+                             ((request->type == brlapi_request_acceptKeyRanges)? BRLAPI_PACKET_ACCEPTKEYRANGES: BRLAPI_PACKET_IGNOREKEYRANGES),
+                             ints, n*2*sizeof(brlapi_keyCode_t)) < 0)
+        return -1;
+      return 1;
+    }
+
+    case brlapi_request_setParameter: {
+      brlapi_paramValuePacket_t packet;
+      ssize_t size = makeParameterPacket(&packet,
+                                         request->arguments.parameter.parameter,
+                                         request->arguments.parameter.subparam,
+                                         request->arguments.parameter.flags,
+                                         request->arguments.parameter.data,
+                                         request->arguments.parameter.len);
+
+      if (size < 0) return 0;
+      if (brlapi_writePacket(handle->fileDescriptor, BRLAPI_PACKET_PARAM_VALUE, &packet, size) < 0)
+        return -1;
+      return 1;
+    }
+
+    default:
+      brlapi_errno = BRLAPI_ERROR_INVALID_PARAMETER;
+      return 0;
+  }
+}
+
+/* Function : brlapi_sendRequests */
+int BRLAPI_STDCALL brlapi__sendRequests(brlapi_handle_t *handle, brlapi_request_t requests[], unsigned int count, brlapi_requestCompletion_t completion, void *data)
+{
+  unsigned int pending[BRLAPI_REQUEST_PIPELINE_DEPTH];
+  unsigned int first = 0, inFlight = 0;
+  unsigned int sent = 0, completed = 0;
+  int failures = 0;
+  int error;
+
+#define COMPLETE(index, code) do { \
+  requests[(index)].error = (code); \
+  if ((code) != BRLAPI_ERROR_SUCCESS) failures++; \
+  completed++; \
+  if (completion) completion(handle, &requests[(index)], (index), data); \
+} while (0)
+
+  pthread_mutex_lock(&handle->req_mutex);
+
+  while (completed < count) {
+    if ((sent < count) && (inFlight < BRLAPI_REQUEST_PIPELINE_DEPTH)) {
+      int written = writeRequest(handle, &requests[sent]);
+
+      if (written < 0) goto disconnected;
+
+      if (written) {
+        pending[(first + inFlight++) % BRLAPI_REQUEST_PIPELINE_DEPTH] = sent;
+      } else {
+        COMPLETE(sent, brlapi_errno);
+      }
+
+      sent++;
+    } else {
+      unsigned int index = pending[first];
+
+      int result = brlapi__waitForAck(handle);
+
+      if (result < -1) {
+        /* the connection was lost (-2) or the reader gave up on it (-3) */
+        brlapi_errno = BRLAPI_ERROR_EOF;
+        goto disconnected;
+      }
+
+      if (result < 0) {
+        if ((brlapi_errno == BRLAPI_ERROR_EOF) || (brlapi_errno == BRLAPI_ERROR_LIBCERR)) goto disconnected;
+        error = brlapi_errno;
+      } else {
+        error = BRLAPI_ERROR_SUCCESS;
+      }
+
+      first = (first + 1) % BRLAPI_REQUEST_PIPELINE_DEPTH;
+      inFlight--;
+      COMPLETE(index, error);
+    }
+  }
+
+  pthread_mutex_unlock(&handle->req_mutex);
+  return failures;
+
+disconnected:
+  /* the outcome of whatever hasn't been acknowledged is unknown */
+  error = brlapi_errno;
+
+  while (inFlight) {
+    unsigned int index = pending[first];
+    first = (first + 1) % BRLAPI_REQUEST_PIPELINE_DEPTH;
+    inFlight--;
+    COMPLETE(index, error);
+  }
+
+  while (sent < count) {
+    COMPLETE(sent, error);
+    sent++;
+  }
+
+  pthread_mutex_unlock(&handle->req_mutex);
+  brlapi_errno = error;
+  return -1;
+#undef COMPLETE
+}
+
+int BRLAPI_STDCALL brlapi_sendRequests(brlapi_request_t requests[], unsigned int count, brlapi_requestCompletion_t completion, void *data)
+{
+  return brlapi__sendRequests(&defaultHandle, requests, count, completion, data);
+}
+
+/* Function : brlapi_changeKeyRanges */
+int BRLAPI_STDCALL brlapi__changeKeyRanges(brlapi_handle_t *handle, const brlapi_keyRangeChange_t changes[], unsigned int count)
+{
+  brlapi_request_t *requests;
+  unsigned int i;
+  int res;
+
+  if (!count) return 0;
+
+  if (!(requests = malloc(count * sizeof(*requests)))) {
+    brlapi_errno = BRLAPI_ERROR_NOMEM;
+    return -1;
+  }
+
+  for (i=0; i<count; i++) {
+    requests[i].type = changes[i].accept? brlapi_request_acceptKeyRanges: brlapi_request_ignoreKeyRanges;
+    requests[i].arguments.keyRanges.ranges = changes[i].ranges;
+    requests[i].arguments.keyRanges.count = changes[i].count;
+  }
+
+  if ((res = brlapi__sendRequests(handle, requests, count, NULL, NULL)) > 0) {
+    for (i=0; i<count; i++) {
+      if (requests[i].error != BRLAPI_ERROR_SUCCESS) {
+        brlapi_errno = requests[i].error;
+        break;
+      }
+    }
+  }
+
+  free(requests);
+  return res? -1: 0;
+}
+
+int BRLAPI_STDCALL brlapi_changeKeyRanges(const brlapi_keyRangeChange_t changes[], unsigned int count)
+{
+  return brlapi__changeKeyRanges(&defaultHandle, changes, count);
+}
+
 /* Error code handling */
 
 /* brlapi_errlist: error messages */
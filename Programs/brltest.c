@@ -46,6 +46,7 @@ static char *opt_brailleDevice;
 char *opt_driversDirectory;
 static char *opt_tablesDirectory;
 static char *opt_writableDirectory;
+static char *opt_logLevel;
 
 BEGIN_OPTION_TABLE(programOptions)
   { .word = "drivers-directory",
@@ -85,6 +86,14 @@ BEGIN_OPTION_TABLE(programOptions)
     .internal.setting = BRAILLE_DEVICE,
     .description = "Path to device for accessing braille display."
   },
+
+  { .word = "log-level",
+    .letter = 'l',
+    .flags = OPT_Hidden,
+    .argument = "level",
+    .setting.string = &opt_logLevel,
+    .description = "Lowest priority of the messages to write to standard error."
+  },
 END_OPTION_TABLE
 
 int
@@ -106,6 +115,17 @@ main (int argc, char *argv[]) {
 
   setWritableDirectory(opt_writableDirectory);
 
+  if (*opt_logLevel) {
+    unsigned int level;
+
+    if (!isLogLevel(&level, opt_logLevel)) {
+      logMessage(LOG_ERR, "unknown log level: %s", opt_logLevel);
+      return PROG_EXIT_SYNTAX;
+    }
+
+    stderrLogLevel = level;
+  }
+
   if (argc) {
     driver = *argv++, --argc;
   }
@@ -303,4 +323,35 @@ alert (AlertIdentifier identifier) {
 
 #include "api_control.h"
 
-const ApiMethods api;
+static int
+testClaimDriver (void) {
+  return 1;
+}
+
+static void
+testReleaseDriver (void) {
+}
+
+static int
+testIsServerRunning (void) {
+  return 0;
+}
+
+static int
+testHandleKeyEvent (KeyGroup group, KeyNumber number, int press) {
+  return 0;
+}
+
+static void
+testUpdateParameter (brlapi_param_t parameter, brlapi_param_subparam_t subparam) {
+}
+
+const ApiMethods api = {
+  .isServerRunning = testIsServerRunning,
+
+  .claimDriver = testClaimDriver,
+  .releaseDriver = testReleaseDriver,
+
+  .handleKeyEvent = testHandleKeyEvent,
+  .updateParameter = testUpdateParameter
+};
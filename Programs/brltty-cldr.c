@@ -32,6 +32,7 @@
 #define DEFAULT_OUTPUT_FORMAT "%s\\t%n\\n"
 
 static char *opt_outputFormat;
+static char *opt_compiledFile;
 
 BEGIN_OPTION_TABLE(programOptions)
   { .word = "output-format",
@@ -41,6 +42,13 @@ BEGIN_OPTION_TABLE(programOptions)
     .internal.setting = DEFAULT_OUTPUT_FORMAT,
     .description = strtext("Format of each output line.")
   },
+
+  { .word = "compiled-file",
+    .letter = 'c',
+    .argument = strtext("file"),
+    .setting.string = &opt_compiledFile,
+    .description = strtext("Write the compiled (binary) form of the annotations to this file.")
+  },
 END_OPTION_TABLE
 
 static void
@@ -224,6 +232,12 @@ main (int argc, char *argv[]) {
     return PROG_EXIT_SYNTAX;
   }
 
+  if (*opt_compiledFile) {
+    return cldrCompileFile(inputFile, opt_compiledFile)?
+           PROG_EXIT_SUCCESS:
+           PROG_EXIT_FATAL;
+  }
+
   return cldrParseFile(inputFile, handleAnnotation, NULL)?
          PROG_EXIT_SUCCESS:
          PROG_EXIT_FATAL;
@@ -26,6 +26,7 @@
 #include "log.h"
 #include "file.h"
 #include "parse.h"
+#include "timing.h"
 #include "dynld.h"
 #include "ktb.h"
 #include "ktb_keyboard.h"
@@ -35,6 +36,7 @@ static int opt_audit;
 static int opt_listKeyNames;
 static int opt_listHelpScreen;
 static int opt_listRestructuredText;
+static int opt_timeKeyTable;
 static char *opt_tablesDirectory;
 char *opt_driversDirectory;
 
@@ -63,6 +65,12 @@ BEGIN_OPTION_TABLE(programOptions)
     .description = strtext("List key table in reStructuredText format.")
   },
 
+  { .word = "time",
+    .letter = 't',
+    .setting.flag = &opt_timeKeyTable,
+    .description = strtext("Report how long the key table takes to load and to list.")
+  },
+
   { .word = "tables-directory",
     .letter = 'T',
     .flags = OPT_Hidden,
@@ -200,6 +208,48 @@ hlpWriteLine (const wchar_t *line, void *data) {
   return writeLine(line);
 }
 
+static long int
+getMicrosecondsSince (const TimeValue *start) {
+  TimeValue now;
+  getMonotonicTime(&now);
+
+  return ((long int)(now.seconds - start->seconds) * USECS_PER_SEC)
+       + ((now.nanoseconds - start->nanoseconds) / NSECS_PER_USEC);
+}
+
+static int
+countLine (const wchar_t *line, void *data) {
+  unsigned int *count = data;
+  *count += 1;
+  return 1;
+}
+
+/* This is what a key table costs at startup (compiling it) and when its
+ * help page is first shown (listing it).
+ */
+static int
+timeKeyTable (const char *name, const KeyTableDescriptor *ktd) {
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  KeyTable *keyTable = compileKeyTable(ktd->path, ktd->names);
+  long int compiled = getMicrosecondsSince(&start);
+  if (!keyTable) return 0;
+
+  unsigned int lines = 0;
+  getMonotonicTime(&start);
+  int listed = listKeyTable(keyTable, NULL, countLine, &lines);
+  long int elapsed = getMicrosecondsSince(&start);
+
+  destroyKeyTable(keyTable);
+  if (!listed) return 0;
+
+  printf("%s: compiled in %ldus, %u help lines listed in %ldus\n",
+         name, compiled, lines, elapsed);
+
+  return 1;
+}
+
 typedef struct {
   unsigned int headerLevel;
   unsigned int elementLevel;
@@ -355,6 +405,14 @@ main (int argc, char *argv[]) {
         }
       }
 
+      if (exitStatus == PROG_EXIT_SUCCESS) {
+        if (opt_timeKeyTable) {
+          if (!timeKeyTable(tableName, &ktd)) {
+            exitStatus = PROG_EXIT_FATAL;
+          }
+        }
+      }
+
       if (exitStatus == PROG_EXIT_SUCCESS) {
         KeyTable *keyTable = compileKeyTable(ktd.path, ktd.names);
 
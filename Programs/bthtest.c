@@ -0,0 +1,393 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* bthtest times Bluetooth (re)connections through a stand-in transport */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "file.h"
+#include "io_bluetooth.h"
+#include "bluetooth_internal.h"
+
+static char *opt_queryTime;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "query",
+    .letter = 'q',
+    .argument = "msecs",
+    .setting.string = &opt_queryTime,
+    .internal.setting = "500",
+    .description = "how long a name request or a channel query takes"
+  },
+END_OPTION_TABLE
+
+static int queryTime;
+
+static int
+validateOptions (void) {
+  static const int minimum = 10;
+
+  if (!validateInteger(&queryTime, opt_queryTime, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid query time: %s", opt_queryTime);
+    return 0;
+  }
+
+  return 1;
+}
+
+/* The stand-in transport: a device whose name request and channel query
+ * take as long as they can on real hardware, and which only accepts
+ * connections on its serial port channel.
+ */
+
+static struct {
+  uint8_t channel;
+  int error;
+
+  unsigned int nameRequests;
+  unsigned int channelQueries;
+  unsigned int channelOpens;
+} standIn;
+
+struct BluetoothConnectionExtensionStruct {
+  uint64_t address;
+};
+
+char *
+bthObtainDeviceName (uint64_t bda, int timeout) {
+  standIn.nameRequests += 1;
+  approximateDelay(queryTime);
+
+  if (standIn.error) {
+    errno = standIn.error;
+    return NULL;
+  }
+
+  char *name = strdup("Stand-In Display");
+  if (!name) logMallocError();
+  return name;
+}
+
+BluetoothConnectionExtension *
+bthNewConnectionExtension (uint64_t bda) {
+  BluetoothConnectionExtension *bcx;
+
+  if ((bcx = malloc(sizeof(*bcx)))) {
+    bcx->address = bda;
+    return bcx;
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+void
+bthReleaseConnectionExtension (BluetoothConnectionExtension *bcx) {
+  free(bcx);
+}
+
+int
+bthPollInput (BluetoothConnectionExtension *bcx, int timeout) {
+  errno = EAGAIN;
+  return 0;
+}
+
+ssize_t
+bthGetData (
+  BluetoothConnectionExtension *bcx, void *buffer, size_t size,
+  int initialTimeout, int subsequentTimeout
+) {
+  errno = EAGAIN;
+  return -1;
+}
+
+ssize_t
+bthPutData (BluetoothConnectionExtension *bcx, const void *buffer, size_t size) {
+  return size;
+}
+
+int
+bthDiscoverChannel (
+  uint8_t *channel, BluetoothConnectionExtension *bcx,
+  const void *uuidBytes, size_t uuidLength,
+  int timeout
+) {
+  standIn.channelQueries += 1;
+  approximateDelay(queryTime);
+
+  if (standIn.error) {
+    errno = standIn.error;
+    return 0;
+  }
+
+  *channel = standIn.channel;
+  return 1;
+}
+
+int
+bthOpenChannel (BluetoothConnectionExtension *bcx, uint8_t channel, int timeout) {
+  standIn.channelOpens += 1;
+
+  if (standIn.error) {
+    errno = standIn.error;
+    return 0;
+  }
+
+  if (channel != standIn.channel) {
+    errno = ECONNREFUSED;
+    return 0;
+  }
+
+  return 1;
+}
+
+void
+bthProcessDiscoveredDevices (
+  DiscoveredBluetoothDeviceTester *testDevice, void *data
+) {
+}
+
+static const char deviceIdentifier[] = "address=00:11:22:33:44:55";
+static char cacheDirectory[] = "/tmp/bthtest-XXXXXX";
+
+static void
+restartProgram (void) {
+  endProgram();
+  bthForgetDevices();
+  setUpdatableDirectory(cacheDirectory);
+}
+
+static int
+getCacheIdentity (struct stat *status) {
+  char *path = makeUpdatablePath("bluetooth-devices");
+  if (!path) return 0;
+
+  int exists = stat(path, status) != -1;
+  if (!exists) memset(status, 0, sizeof(*status));
+
+  free(path);
+  return exists;
+}
+
+typedef struct {
+  const char *name;
+  int connect;
+  unsigned int channelQueries;
+  unsigned int channelOpens;
+} ConnectionTest;
+
+static int
+testConnection (const ConnectionTest *test) {
+  unsigned int channelQueries = standIn.channelQueries;
+  unsigned int channelOpens = standIn.channelOpens;
+
+  BluetoothConnectionRequest request;
+  bthInitializeConnectionRequest(&request);
+  request.identifier = deviceIdentifier;
+  request.driver = "ht";
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  BluetoothConnection *connection = bthOpenConnection(&request);
+  long int elapsed = getMonotonicElapsed(&start);
+  int error = errno;
+
+  channelQueries = standIn.channelQueries - channelQueries;
+  channelOpens = standIn.channelOpens - channelOpens;
+
+  printf("%s: %ldms, %s, %u channel %s, %u channel %s\n",
+         test->name, elapsed,
+         (connection? "connected": strerror(error)),
+         channelQueries, ((channelQueries == 1)? "query": "queries"),
+         channelOpens, ((channelOpens == 1)? "open": "opens"));
+
+  if (connection) bthCloseConnection(connection);
+
+  if (!connection != !test->connect) {
+    logMessage(LOG_ERR, "%s: unexpected connection result", test->name);
+    return 0;
+  }
+
+  if ((channelQueries != test->channelQueries) || (channelOpens != test->channelOpens)) {
+    logMessage(LOG_ERR, "%s: expected %u channel queries and %u channel opens",
+               test->name, test->channelQueries, test->channelOpens);
+    return 0;
+  }
+
+  return 1;
+}
+
+static int
+testName (const char *name, unsigned int nameRequests) {
+  unsigned int before = standIn.nameRequests;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  char *deviceName = bthGetNameAtAddress(&deviceIdentifier[8], 0);
+  long int elapsed = getMonotonicElapsed(&start);
+  unsigned int requests = standIn.nameRequests - before;
+
+  printf("%s: %ldms, %s, %u name %s\n",
+         name, elapsed, (deviceName? deviceName: "no name"),
+         requests, ((requests == 1)? "request": "requests"));
+
+  if (!deviceName || (requests != nameRequests)) {
+    logMessage(LOG_ERR, "%s: expected %u name requests", name, nameRequests);
+    return 0;
+  }
+
+  return 1;
+}
+
+static int
+testDeviceCache (void) {
+  standIn.channel = 3;
+
+  {
+    static const ConnectionTest test = {
+      .name = "first connection",
+      .connect = 1,
+      .channelQueries = 1,
+      .channelOpens = 1
+    };
+
+    if (!testConnection(&test)) return 0;
+  }
+
+  if (!testName("first name", 1)) return 0;
+  restartProgram();
+
+  {
+    static const ConnectionTest test = {
+      .name = "reconnection after a restart",
+      .connect = 1,
+      .channelQueries = 0,
+      .channelOpens = 1
+    };
+
+    if (!testConnection(&test)) return 0;
+  }
+
+  if (!testName("name after a restart", 0)) return 0;
+
+  /* the cached channel is tried first, and then it's discovered again */
+  standIn.channel = 5;
+  restartProgram();
+
+  {
+    static const ConnectionTest test = {
+      .name = "reconnection to a moved channel",
+      .connect = 1,
+      .channelQueries = 1,
+      .channelOpens = 2
+    };
+
+    if (!testConnection(&test)) return 0;
+  }
+
+  /* retrying a device which is away mustn't keep rewriting the cache */
+  struct stat oldStatus;
+  getCacheIdentity(&oldStatus);
+  standIn.error = EHOSTDOWN;
+
+  {
+    static const ConnectionTest test = {
+      .name = "device away",
+      .connect = 0,
+      .channelQueries = 0,
+      .channelOpens = 1
+    };
+
+    if (!testConnection(&test)) return 0;
+  }
+
+  {
+    static const ConnectionTest test = {
+      .name = "device still away",
+      .connect = 0,
+      .channelQueries = 0,
+      .channelOpens = 0
+    };
+
+    if (!testConnection(&test)) return 0;
+  }
+
+  {
+    struct stat newStatus;
+    getCacheIdentity(&newStatus);
+
+    if ((newStatus.st_ino != oldStatus.st_ino) ||
+        (newStatus.st_mtime != oldStatus.st_mtime) ||
+        (newStatus.st_size != oldStatus.st_size)) {
+      logMessage(LOG_ERR, "device cache rewritten while the device is away");
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "bthtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+
+  if (!mkdtemp(cacheDirectory)) {
+    logSystemError("mkdtemp");
+    return PROG_EXIT_FATAL;
+  }
+
+  setUpdatableDirectory(cacheDirectory);
+  int ok = testDeviceCache();
+
+  {
+    char *path = makeUpdatablePath("bluetooth-devices");
+
+    if (path) {
+      unlink(path);
+      free(path);
+    }
+  }
+
+  rmdir(cacheDirectory);
+  return ok? PROG_EXIT_SUCCESS: PROG_EXIT_FATAL;
+}
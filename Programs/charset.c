@@ -103,6 +103,26 @@ convertUtf8ToChar (const char **utf8, size_t *utfs) {
   return convertWcharToChar(wc);
 }
 
+void
+convertCharsToWchars (const char *chars, wchar_t *characters, size_t count, wchar_t substitute) {
+  const char *end = chars + count;
+
+  while (chars < end) {
+    wint_t wc = convertCharToWchar(*chars++);
+    *characters++ = (wc == WEOF)? substitute: wc;
+  }
+}
+
+void
+convertWcharsToChars (const wchar_t *characters, char *chars, size_t count, char substitute) {
+  const wchar_t *end = characters + count;
+
+  while (characters < end) {
+    int c = convertWcharToChar(*characters++);
+    *chars++ = (c == EOF)? substitute: c;
+  }
+}
+
 const char *
 getWcharCharset (void) {
   static const char *wcharCharset = NULL;
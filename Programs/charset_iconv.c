@@ -39,22 +39,149 @@ static CHARSET_ICONV_HANDLE(CharToWchar);
 static CHARSET_ICONV_HANDLE(WcharToChar);
 
 #define CHARSET_CONVERT_TYPE_TO_TYPE(name, from, to, ret, eof) \
-ret convert##name (from f) { \
-  if (getCharset()) { \
-    from *fp = &f; \
-    size_t fs = sizeof(f); \
-    to t; \
-    to *tp = &t; \
-    size_t ts = sizeof(t); \
-    if (iconv(iconv##name, (void *)&fp, &fs, (void *)&tp, &ts) != (size_t)-1) return t; \
-    logMessage(LOG_DEBUG, "iconv (" #from " -> " #to ") error: %s", strerror(errno)); \
-  } \
+static ret convert##name##WithIconv (from f) { \
+  from *fp = &f; \
+  size_t fs = sizeof(f); \
+  to t; \
+  to *tp = &t; \
+  size_t ts = sizeof(t); \
+  if (iconv(iconv##name, (void *)&fp, &fs, (void *)&tp, &ts) != (size_t)-1) return t; \
+  logMessage(LOG_DEBUG, "iconv (" #from " -> " #to ") error: %s", strerror(errno)); \
   return eof; \
 }
 CHARSET_CONVERT_TYPE_TO_TYPE(CharToWchar, char, wchar_t, wint_t, WEOF)
 CHARSET_CONVERT_TYPE_TO_TYPE(WcharToChar, wchar_t, unsigned char, int, EOF)
 #undef CHARSET_CONVERT_TYPE_TO_TYPE
 
+#define CHARSET_BYTE_COUNT 0X100
+#define CHARSET_REVERSE_HASH_BITS 9
+#define CHARSET_REVERSE_HASH_SIZE (1 << CHARSET_REVERSE_HASH_BITS)
+
+typedef struct {
+  wchar_t character;
+  unsigned char byte;
+  unsigned char used;
+} CharsetReverseEntry;
+
+/* Single-byte charsets are converted via tables which are built (with iconv)
+ * whenever the charset changes. Anything else goes through iconv.
+ */
+static struct {
+  unsigned char isSingleByte;
+  wint_t toWchar[CHARSET_BYTE_COUNT];
+  CharsetReverseEntry toChar[CHARSET_REVERSE_HASH_SIZE];
+} charsetTables;
+
+static inline unsigned int
+getCharsetReverseHash (wchar_t character) {
+  return ((uint32_t)character * UINT32_C(0X9E3779B1)) >> (32 - CHARSET_REVERSE_HASH_BITS);
+}
+
+static const CharsetReverseEntry *
+findCharsetReverseEntry (wchar_t character) {
+  unsigned int index = getCharsetReverseHash(character);
+
+  while (1) {
+    const CharsetReverseEntry *entry = &charsetTables.toChar[index];
+
+    if (!entry->used) return NULL;
+    if (entry->character == character) return entry;
+
+    index = (index + 1) % CHARSET_REVERSE_HASH_SIZE;
+  }
+}
+
+static void
+addCharsetReverseEntry (wchar_t character, unsigned char byte) {
+  unsigned int index = getCharsetReverseHash(character);
+
+  while (1) {
+    CharsetReverseEntry *entry = &charsetTables.toChar[index];
+
+    if (!entry->used) {
+      entry->character = character;
+      entry->byte = byte;
+      entry->used = 1;
+      return;
+    }
+
+    if (entry->character == character) return;
+    index = (index + 1) % CHARSET_REVERSE_HASH_SIZE;
+  }
+}
+
+static int
+testSingleByteCharset (void) {
+  for (unsigned int byte=0; byte<CHARSET_BYTE_COUNT; byte+=1) {
+    char c = byte;
+    char *fp = &c;
+    size_t fs = sizeof(c);
+
+    wchar_t wc;
+    wchar_t *tp = &wc;
+    size_t ts = sizeof(wc);
+
+    iconv(iconvCharToWchar, NULL, NULL, NULL, NULL);
+
+    if (iconv(iconvCharToWchar, &fp, &fs, (void *)&tp, &ts) != (size_t)-1) {
+      /* a byte which only changes the shift state */
+      if (ts) return 0;
+
+      charsetTables.toWchar[byte] = wc;
+    } else if (errno == EILSEQ) {
+      charsetTables.toWchar[byte] = WEOF;
+    } else {
+      /* the lead byte of a multibyte sequence */
+      return 0;
+    }
+  }
+
+  iconv(iconvCharToWchar, NULL, NULL, NULL, NULL);
+  return 1;
+}
+
+static void
+makeCharsetTables (const char *charset) {
+  memset(&charsetTables, 0, sizeof(charsetTables));
+
+  if (testSingleByteCharset()) {
+    for (unsigned int byte=0; byte<CHARSET_BYTE_COUNT; byte+=1) {
+      wint_t wc = charsetTables.toWchar[byte];
+
+      if (wc != WEOF) {
+        /* let iconv decide which byte a shared character maps back to */
+        int c = convertWcharToCharWithIconv(wc);
+        if (c != EOF) addCharsetReverseEntry(wc, c);
+      }
+    }
+
+    iconv(iconvWcharToChar, NULL, NULL, NULL, NULL);
+    charsetTables.isSingleByte = 1;
+    logMessage(LOG_DEBUG, "charset conversion tables built: %s", charset);
+  } else {
+    logMessage(LOG_DEBUG, "charset converted via iconv: %s", charset);
+  }
+}
+
+wint_t
+convertCharToWchar (char c) {
+  if (!getCharset()) return WEOF;
+  if (charsetTables.isSingleByte) return charsetTables.toWchar[(unsigned char)c];
+  return convertCharToWcharWithIconv(c);
+}
+
+int
+convertWcharToChar (wchar_t wc) {
+  if (!getCharset()) return EOF;
+
+  if (charsetTables.isSingleByte) {
+    const CharsetReverseEntry *entry = findCharsetReverseEntry(wc);
+    if (entry) return entry->byte;
+  }
+
+  return convertWcharToCharWithIconv(wc);
+}
+
 const char *
 getLocaleCharset (void) {
   const char *locale = setlocale(LC_ALL, "");
@@ -144,6 +271,8 @@ registerCharacterSet (const char *charset) {
     *conv->handle = conv->newHandle;
   }
 
+  makeCharsetTables(charset);
+
   if (firstTime) onProgramExit("charset-iconv", exitCharsetIconv, NULL);
   return 1;
 }
@@ -23,6 +23,10 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif /* HAVE_MMAP */
+
 #include "log.h"
 #include "cldr.h"
 #include "file.h"
@@ -255,9 +259,211 @@ cldrParseDocument (
 
 const char cldrAnnotationsDirectory[] = "/usr/share/unicode/cldr/common/annotations";
 const char cldrAnnotationsExtension[] = ".xml";
+const char cldrCompiledExtension[] = ".cldrb";
+const char cldrCompiledSubdirectory[] = "cldr";
+
+/* The compiled form of an annotations file:
+ *   magic (8 bytes)
+ *   annotation count (4 bytes)
+ *   for each annotation, sorted by sequence:
+ *     sequence offset (4 bytes)
+ *     name offset (4 bytes)
+ *   nul-terminated UTF-8 strings
+ * All numbers are unsigned and big-endian, and all offsets are from the
+ * start of the file.
+ */
+static const unsigned char compiledMagic[] = {'B', 'R', 'L', 'C', 'L', 'D', 'R', 1};
+#define COMPILED_HEADER_SIZE (sizeof(compiledMagic) + 4)
+#define COMPILED_ENTRY_SIZE 8
+
+static uint32_t
+getCompiledNumber (const unsigned char *bytes) {
+  return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16)
+       | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
 
-int
-cldrParseFile (
+static void
+putCompiledNumber (unsigned char *bytes, uint32_t number) {
+  bytes[0] = number >> 24;
+  bytes[1] = number >> 16;
+  bytes[2] = number >> 8;
+  bytes[3] = number;
+}
+
+static int
+processCompiledAnnotations (
+  const unsigned char *bytes, size_t size, const char *path,
+  CLDR_AnnotationHandler *handler, void *data, int *accepted
+) {
+  if ((size < COMPILED_HEADER_SIZE) ||
+      (memcmp(bytes, compiledMagic, sizeof(compiledMagic)) != 0)) {
+    logMessage(LOG_WARNING, "not a compiled CLDR annotations file: %s", path);
+    return 0;
+  }
+
+  uint32_t count = getCompiledNumber(&bytes[sizeof(compiledMagic)]);
+  const unsigned char *entry = &bytes[COMPILED_HEADER_SIZE];
+  size_t strings = COMPILED_HEADER_SIZE + ((size_t)count * COMPILED_ENTRY_SIZE);
+
+  if ((count > ((size - COMPILED_HEADER_SIZE) / COMPILED_ENTRY_SIZE)) ||
+      (count && ((strings == size) || bytes[size-1]))) {
+    logMessage(LOG_WARNING, "malformed compiled CLDR annotations file: %s", path);
+    return 0;
+  }
+
+  /* verify all of the offsets first so that a damaged file adds no rules */
+  for (size_t index=0; index<((size_t)count * 2); index+=1) {
+    uint32_t offset = getCompiledNumber(&entry[index * 4]);
+
+    if ((offset < strings) || (offset >= size)) {
+      logMessage(LOG_WARNING, "malformed compiled CLDR annotations file: %s", path);
+      return 0;
+    }
+  }
+
+  *accepted = 1;
+
+  while (count > 0) {
+    CLDR_AnnotationHandlerParameters parameters = {
+      .sequence = (const char *)&bytes[getCompiledNumber(&entry[0])],
+      .name = (const char *)&bytes[getCompiledNumber(&entry[4])],
+      .data = data
+    };
+
+    if (!handler(&parameters)) return 0;
+    entry += COMPILED_ENTRY_SIZE;
+    count -= 1;
+  }
+
+  return 1;
+}
+
+/* *accepted is set once the file has been validated, i.e. as soon as the
+ * handler may have been called - until then, another source can be tried
+ * without risking duplicate annotations
+ */
+static int
+parseCompiledFile (
+  const char *path,
+  CLDR_AnnotationHandler *handler, void *data, int *accepted
+) {
+  int ok = 0;
+  *accepted = 0;
+  logMessage(LOG_DEBUG, "processing compiled CLDR annotations file: %s", path);
+  int fd = open(path, O_RDONLY);
+
+  if (fd != -1) {
+    struct stat status;
+
+    if (fstat(fd, &status) != -1) {
+      size_t size = status.st_size;
+
+#ifdef HAVE_MMAP
+      void *address = size? mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0): NULL;
+
+      if (!size || (address != MAP_FAILED)) {
+        ok = processCompiledAnnotations(address, size, path, handler, data, accepted);
+        if (address) munmap(address, size);
+      } else {
+        logMessage(LOG_WARNING, "CLDR map error: %s: %s", strerror(errno), path);
+      }
+#else /* HAVE_MMAP */
+      unsigned char *buffer = malloc(size+1);
+
+      if (buffer) {
+        size_t length = 0;
+
+        while (length < size) {
+          ssize_t count = read(fd, &buffer[length], size-length);
+
+          if (count == -1) {
+            if (errno == EINTR) continue;
+            logMessage(LOG_WARNING, "CLDR read error: %s: %s", strerror(errno), path);
+            break;
+          }
+
+          if (!count) break;
+          length += count;
+        }
+
+        if (length == size) ok = processCompiledAnnotations(buffer, size, path, handler, data, accepted);
+        free(buffer);
+      } else {
+        logMallocError();
+      }
+#endif /* HAVE_MMAP */
+    } else {
+      logMessage(LOG_WARNING, "CLDR stat error: %s: %s", strerror(errno), path);
+    }
+
+    close(fd);
+  } else {
+    logMessage(LOG_WARNING, "CLDR open error: %s: %s", strerror(errno), path);
+  }
+
+  return ok;
+}
+
+/* Compiled files are generated (see brltty-cldr -c) into the cldr
+ * subdirectory of the updatable directory when brltty is installed.
+ */
+static char *
+makeCompiledPath (const char *name, const char *extension) {
+  if (isExplicitPath(name)) return ensureFileExtension(name, extension);
+  const char *directory = getUpdatableDirectory();
+
+#ifdef UPDATABLE_DIRECTORY
+  if (!directory) directory = UPDATABLE_DIRECTORY;
+#endif /* UPDATABLE_DIRECTORY */
+
+  if (!directory) return NULL;
+  char *path = NULL;
+  char *subdirectory = makePath(directory, cldrCompiledSubdirectory);
+
+  if (subdirectory) {
+    path = makeFilePath(subdirectory, name, extension);
+    free(subdirectory);
+  }
+
+  return path;
+}
+
+static char *
+getCompiledPath (const char *name) {
+  if (locatePathExtension(name)) return NULL;
+
+  char *compiledPath = makeCompiledPath(name, cldrCompiledExtension);
+  if (!compiledPath) return NULL;
+
+  {
+    struct stat compiledStatus;
+
+    if (stat(compiledPath, &compiledStatus) != -1) {
+      if (S_ISREG(compiledStatus.st_mode)) {
+        char *documentPath = makeFilePath(cldrAnnotationsDirectory, name, cldrAnnotationsExtension);
+
+        if (documentPath) {
+          struct stat documentStatus;
+          int stale = (stat(documentPath, &documentStatus) != -1) &&
+                      (documentStatus.st_mtime > compiledStatus.st_mtime);
+
+          if (stale) {
+            logMessage(LOG_DEBUG, "compiled CLDR annotations file is stale: %s", compiledPath);
+          }
+
+          free(documentPath);
+          if (!stale) return compiledPath;
+        }
+      }
+    }
+  }
+
+  free(compiledPath);
+  return NULL;
+}
+
+static int
+parseDocumentFile (
   const char *name,
   CLDR_AnnotationHandler *handler, void *data
 ) {
@@ -319,3 +525,195 @@ cldrParseFile (
 
   return ok;
 }
+
+int
+cldrParseFile (
+  const char *name,
+  CLDR_AnnotationHandler *handler, void *data
+) {
+  if (hasFileExtension(name, cldrCompiledExtension)) {
+    int ok = 0;
+    char *path = makeCompiledPath(name, NULL);
+
+    if (path) {
+      int accepted;
+      ok = parseCompiledFile(path, handler, data, &accepted);
+      free(path);
+    }
+
+    return ok;
+  }
+
+  {
+    char *path = getCompiledPath(name);
+
+    if (path) {
+      int accepted;
+      int ok = parseCompiledFile(path, handler, data, &accepted);
+
+      if (!accepted) {
+        logMessage(LOG_WARNING, "compiled CLDR annotations file not usable: %s", path);
+      }
+
+      free(path);
+      if (accepted) return ok;
+    }
+  }
+
+  return parseDocumentFile(name, handler, data);
+}
+
+typedef struct {
+  char *sequence;
+  char *name;
+  unsigned int order;
+} CompiledAnnotation;
+
+typedef struct {
+  CompiledAnnotation *array;
+  unsigned int size;
+  unsigned int count;
+  size_t strings;
+} CompiledAnnotations;
+
+static
+CLDR_ANNOTATION_HANDLER(addCompiledAnnotation) {
+  CompiledAnnotations *annotations = parameters->data;
+
+  if (annotations->count == annotations->size) {
+    unsigned int newSize = annotations->size? annotations->size<<1: 0X100;
+    CompiledAnnotation *newArray = realloc(annotations->array, ARRAY_SIZE(newArray, newSize));
+
+    if (!newArray) {
+      logMallocError();
+      return 0;
+    }
+
+    annotations->array = newArray;
+    annotations->size = newSize;
+  }
+
+  {
+    CompiledAnnotation *annotation = &annotations->array[annotations->count];
+
+    if ((annotation->sequence = strdup(parameters->sequence))) {
+      if ((annotation->name = strdup(parameters->name))) {
+        annotation->order = annotations->count++;
+        annotations->strings += strlen(annotation->sequence) + 1;
+        annotations->strings += strlen(annotation->name) + 1;
+        return 1;
+      }
+
+      free(annotation->sequence);
+    }
+  }
+
+  logMallocError();
+  return 0;
+}
+
+static int
+sortCompiledAnnotations (const void *element1, const void *element2) {
+  const CompiledAnnotation *annotation1 = element1;
+  const CompiledAnnotation *annotation2 = element2;
+  int relation = strcmp(annotation1->sequence, annotation2->sequence);
+
+  if (relation) return relation;
+  if (annotation1->order < annotation2->order) return -1;
+  if (annotation1->order > annotation2->order) return 1;
+  return 0;
+}
+
+static int
+writeCompiledAnnotations (const CompiledAnnotations *annotations, const char *path) {
+  size_t strings = COMPILED_HEADER_SIZE + (annotations->count * COMPILED_ENTRY_SIZE);
+  size_t size = strings + annotations->strings;
+
+  if (size > UINT32_MAX) {
+    logMessage(LOG_ERR, "too many CLDR annotations: %u", annotations->count);
+    return 0;
+  }
+
+  unsigned char *bytes = malloc(size);
+
+  if (!bytes) {
+    logMallocError();
+    return 0;
+  }
+
+  memcpy(bytes, compiledMagic, sizeof(compiledMagic));
+  putCompiledNumber(&bytes[sizeof(compiledMagic)], annotations->count);
+
+  {
+    unsigned char *entry = &bytes[COMPILED_HEADER_SIZE];
+    size_t offset = strings;
+
+    for (unsigned int index=0; index<annotations->count; index+=1) {
+      const CompiledAnnotation *annotation = &annotations->array[index];
+      const char *const texts[] = {annotation->sequence, annotation->name};
+
+      for (unsigned int text=0; text<ARRAY_COUNT(texts); text+=1) {
+        size_t length = strlen(texts[text]) + 1;
+
+        putCompiledNumber(entry, offset);
+        entry += 4;
+
+        memcpy(&bytes[offset], texts[text], length);
+        offset += length;
+      }
+    }
+  }
+
+  /* write a new file and then rename it so that a concurrent reader
+   * (which maps the file) never sees a partially written one */
+  char newPath[strlen(path) + 5];
+  snprintf(newPath, sizeof(newPath), "%s.new", path);
+
+  int ok = 0;
+  FILE *stream = fopen(newPath, "wb");
+
+  if (stream) {
+    if (fwrite(bytes, 1, size, stream) == size) ok = 1;
+    if (fclose(stream) == EOF) ok = 0;
+
+    if (!ok) {
+      logMessage(LOG_ERR, "CLDR write error: %s: %s", strerror(errno), newPath);
+    } else if (rename(newPath, path) == -1) {
+      logMessage(LOG_ERR, "CLDR rename error: %s: %s", strerror(errno), path);
+      ok = 0;
+    }
+
+    if (!ok) unlink(newPath);
+  } else {
+    logMessage(LOG_ERR, "CLDR create error: %s: %s", strerror(errno), newPath);
+  }
+
+  free(bytes);
+  return ok;
+}
+
+int
+cldrCompileFile (const char *name, const char *path) {
+  int ok = 0;
+
+  CompiledAnnotations annotations = {
+    .array = NULL,
+    .size = 0,
+    .count = 0,
+    .strings = 0
+  };
+
+  if (parseDocumentFile(name, addCompiledAnnotation, &annotations)) {
+    qsort(annotations.array, annotations.count, sizeof(*annotations.array), sortCompiledAnnotations);
+    if (writeCompiledAnnotations(&annotations, path)) ok = 1;
+  }
+
+  while (annotations.count > 0) {
+    CompiledAnnotation *annotation = &annotations.array[--annotations.count];
+    free(annotation->sequence);
+    free(annotation->name);
+  }
+
+  if (annotations.array) free(annotations.array);
+  return ok;
+}
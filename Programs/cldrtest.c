@@ -0,0 +1,415 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "file.h"
+#include "utf8.h"
+#include "cldr.h"
+#include "ctb.h"
+
+static char *opt_annotationsFile;
+static char *opt_repeatCount;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "file",
+    .letter = 'f',
+    .argument = "path",
+    .setting.string = &opt_annotationsFile,
+    .description = "a CLDR annotations file to test instead of the generated one"
+  },
+
+  { .word = "repeat",
+    .letter = 'r',
+    .argument = "count",
+    .setting.string = &opt_repeatCount,
+    .internal.setting = "100",
+    .description = "how many times each form is loaded for timing"
+  },
+END_OPTION_TABLE
+
+static int repeatCount;
+
+static int
+validateOptions (void) {
+  static const int minimum = 1;
+
+  if (!validateInteger(&repeatCount, opt_repeatCount, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid repeat count: %s", opt_repeatCount);
+    return 0;
+  }
+
+  return 1;
+}
+
+typedef struct {
+  char *sequence;
+  char *name;
+  unsigned int order;
+} TestAnnotation;
+
+typedef struct {
+  TestAnnotation *array;
+  unsigned int size;
+  unsigned int count;
+} TestAnnotations;
+
+static
+CLDR_ANNOTATION_HANDLER(addTestAnnotation) {
+  TestAnnotations *annotations = parameters->data;
+
+  if (annotations->count == annotations->size) {
+    unsigned int newSize = annotations->size? annotations->size<<1: 0X100;
+    TestAnnotation *newArray = realloc(annotations->array, ARRAY_SIZE(newArray, newSize));
+
+    if (!newArray) {
+      logMallocError();
+      return 0;
+    }
+
+    annotations->array = newArray;
+    annotations->size = newSize;
+  }
+
+  TestAnnotation *annotation = &annotations->array[annotations->count];
+
+  if ((annotation->sequence = strdup(parameters->sequence))) {
+    if ((annotation->name = strdup(parameters->name))) {
+      annotation->order = annotations->count++;
+      return 1;
+    }
+
+    free(annotation->sequence);
+  }
+
+  logMallocError();
+  return 0;
+}
+
+static
+CLDR_ANNOTATION_HANDLER(countTestAnnotation) {
+  unsigned int *count = parameters->data;
+  *count += 1;
+  return 1;
+}
+
+static void
+clearTestAnnotations (TestAnnotations *annotations) {
+  while (annotations->count > 0) {
+    TestAnnotation *annotation = &annotations->array[--annotations->count];
+    free(annotation->sequence);
+    free(annotation->name);
+  }
+
+  if (annotations->array) free(annotations->array);
+  annotations->array = NULL;
+  annotations->size = 0;
+}
+
+static int
+sortTestAnnotations (const void *element1, const void *element2) {
+  const TestAnnotation *annotation1 = element1;
+  const TestAnnotation *annotation2 = element2;
+  int relation = strcmp(annotation1->sequence, annotation2->sequence);
+
+  if (relation) return relation;
+  if (annotation1->order < annotation2->order) return -1;
+  if (annotation1->order > annotation2->order) return 1;
+  return 0;
+}
+
+static void
+writeSequence (FILE *stream, const wchar_t *characters, size_t count) {
+  while (count > 0) {
+    Utf8Buffer utf8;
+    size_t length = convertWcharToUtf8(*characters++, utf8);
+    fwrite(utf8, 1, length, stream);
+    count -= 1;
+  }
+}
+
+static void
+writeAnnotation (FILE *stream, const wchar_t *characters, size_t count, const char *type, const char *name) {
+  fprintf(stream, "    <annotation cp=\"");
+  writeSequence(stream, characters, count);
+  fprintf(stream, "\"%s%s%s>%s</annotation>\n",
+          (type? " type=\"": ""), (type? type: ""), (type? "\"": ""), name);
+}
+
+/* The generated file has what the real ones have: single characters (some
+ * of which aren't emoji), multi-character sequences, names which need XML
+ * escapes, keyword (non-tts) entries, and a sequence annotated twice.
+ */
+static int
+generateAnnotationsFile (const char *path) {
+  FILE *stream = fopen(path, "w");
+
+  if (!stream) {
+    logSystemError("fopen");
+    return 0;
+  }
+
+  fprintf(stream, "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n");
+  fprintf(stream, "<ldml>\n  <identity><language type=\"en\"/></identity>\n  <annotations>\n");
+
+  for (wchar_t character=0X1F300; character<=0X1F6FF; character+=1) {
+    char name[0X40];
+
+    snprintf(name, sizeof(name), "emoji %lX", (unsigned long)character);
+    writeAnnotation(stream, &character, 1, NULL, "keyword | another");
+    writeAnnotation(stream, &character, 1, "tts", name);
+  }
+
+  {
+    static const wchar_t family[] = {0X1F468, 0X200D, 0X1F469, 0X200D, 0X1F467};
+    static const wchar_t thumbs[] = {0X1F44D, 0X1F3FD};
+    static const wchar_t flag[] = {0X1F1E8, 0X1F1E6};
+    static const wchar_t copyright[] = {0XA9};
+    static const wchar_t grinning[] = {0X1F600};
+
+    writeAnnotation(stream, family, ARRAY_COUNT(family), "tts", "family: man, woman, girl");
+    writeAnnotation(stream, thumbs, ARRAY_COUNT(thumbs), "tts", "thumbs up: medium skin tone");
+    writeAnnotation(stream, flag, ARRAY_COUNT(flag), "tts", "flag: Canada");
+    writeAnnotation(stream, copyright, ARRAY_COUNT(copyright), "tts", "copyright &amp; &lt;symbol&gt;");
+    writeAnnotation(stream, grinning, ARRAY_COUNT(grinning), "tts", "grinning face again");
+  }
+
+  fprintf(stream, "  </annotations>\n</ldml>\n");
+
+  if (fclose(stream) == EOF) {
+    logSystemError("fclose");
+    return 0;
+  }
+
+  return 1;
+}
+
+static int
+loadAnnotations (const char *path, TestAnnotations *annotations, long int *time) {
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  for (int iteration=0; iteration<repeatCount; iteration+=1) {
+    unsigned int count = 0;
+    if (!cldrParseFile(path, countTestAnnotation, &count)) return 0;
+  }
+
+  *time = getMonotonicElapsed(&start);
+  return cldrParseFile(path, addTestAnnotation, annotations);
+}
+
+static int
+compareAnnotations (const TestAnnotations *xml, const TestAnnotations *compiled) {
+  if (xml->count != compiled->count) {
+    logMessage(LOG_ERR, "annotation counts differ: XML:%u compiled:%u",
+               xml->count, compiled->count);
+    return 0;
+  }
+
+  for (unsigned int index=0; index<xml->count; index+=1) {
+    const TestAnnotation *x = &xml->array[index];
+    const TestAnnotation *c = &compiled->array[index];
+
+    if ((strcmp(x->sequence, c->sequence) != 0) || (strcmp(x->name, c->name) != 0)) {
+      logMessage(LOG_ERR, "annotation %u differs: XML:%s compiled:%s",
+                 index, x->name, c->name);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static char *
+makeEmojiTable (const char *directory, const char *name, const char *annotations) {
+  char *path = makeFilePath(directory, name, ".ctb");
+
+  if (path) {
+    FILE *stream = fopen(path, "w");
+
+    if (stream) {
+      fprintf(stream, "emoji %s\n", annotations);
+      if (fclose(stream) != EOF) return path;
+      logSystemError("fclose");
+    } else {
+      logSystemError("fopen");
+    }
+
+    free(path);
+  }
+
+  return NULL;
+}
+
+static int
+contractSequence (ContractionTable *table, const char *sequence, unsigned char *cells, int *length) {
+  size_t size = strlen(sequence) + 1;
+  wchar_t characters[size];
+  const char *byte = sequence;
+  wchar_t *character = characters;
+
+  convertUtf8ToWchars(&byte, &character, size);
+  int inputLength = character - characters;
+
+  contractText(table, characters, &inputLength, cells, length, NULL, -1);
+  return inputLength;
+}
+
+/* Both forms must also yield the same emoji rules, so each sequence is
+ * contracted by a table which loads the XML and by one which loads the
+ * compiled file.
+ */
+static int
+compareTables (const char *xmlTablePath, const char *compiledTablePath, const TestAnnotations *annotations) {
+  int ok = 0;
+  ContractionTable *xmlTable = compileContractionTable(xmlTablePath);
+
+  if (xmlTable) {
+    ContractionTable *compiledTable = compileContractionTable(compiledTablePath);
+
+    if (compiledTable) {
+      ok = 1;
+
+      for (unsigned int index=0; index<annotations->count; index+=1) {
+        const char *sequence = annotations->array[index].sequence;
+        unsigned char xmlCells[0X100];
+        unsigned char compiledCells[0X100];
+        int xmlLength = sizeof(xmlCells);
+        int compiledLength = sizeof(compiledCells);
+
+        int xmlConsumed = contractSequence(xmlTable, sequence, xmlCells, &xmlLength);
+        int compiledConsumed = contractSequence(compiledTable, sequence, compiledCells, &compiledLength);
+
+        if ((xmlConsumed != compiledConsumed) ||
+            (xmlLength != compiledLength) ||
+            (memcmp(xmlCells, compiledCells, xmlLength) != 0)) {
+          logMessage(LOG_ERR, "contraction differs: %s", annotations->array[index].name);
+          ok = 0;
+          break;
+        }
+      }
+
+      destroyContractionTable(compiledTable);
+    }
+
+    destroyContractionTable(xmlTable);
+  }
+
+  return ok;
+}
+
+static int
+testDirectory (const char *directory) {
+  int ok = 0;
+  char *xmlPath = *opt_annotationsFile? strdup(opt_annotationsFile): makeFilePath(directory, "annotations", ".xml");
+  char *compiledPath = makeFilePath(directory, "annotations", cldrCompiledExtension);
+  char *xmlTablePath = NULL;
+  char *compiledTablePath = NULL;
+
+  TestAnnotations xml = {.array = NULL};
+  TestAnnotations compiled = {.array = NULL};
+
+  if (!xmlPath || !compiledPath) goto done;
+  if (!*opt_annotationsFile && !generateAnnotationsFile(xmlPath)) goto done;
+
+  if (!cldrCompileFile(xmlPath, compiledPath)) {
+    logMessage(LOG_ERR, "annotations not compiled: %s", xmlPath);
+    goto done;
+  }
+
+  long int xmlTime;
+  long int compiledTime;
+
+  if (!loadAnnotations(xmlPath, &xml, &xmlTime)) goto done;
+  if (!loadAnnotations(compiledPath, &compiled, &compiledTime)) goto done;
+  qsort(xml.array, xml.count, sizeof(*xml.array), sortTestAnnotations);
+
+  printf("annotations: %u, loaded %d times: XML %ldms, compiled %ldms\n",
+         xml.count, repeatCount, xmlTime, compiledTime);
+
+  if (!compareAnnotations(&xml, &compiled)) goto done;
+  if (!(xmlTablePath = makeEmojiTable(directory, "xml", xmlPath))) goto done;
+  if (!(compiledTablePath = makeEmojiTable(directory, "compiled", compiledPath))) goto done;
+  if (!compareTables(xmlTablePath, compiledTablePath, &xml)) goto done;
+
+  printf("XML and compiled annotations are equivalent\n");
+  ok = 1;
+
+done:
+  clearTestAnnotations(&xml);
+  clearTestAnnotations(&compiled);
+
+  if (xmlTablePath) {
+    unlink(xmlTablePath);
+    free(xmlTablePath);
+  }
+
+  if (compiledTablePath) {
+    unlink(compiledTablePath);
+    free(compiledTablePath);
+  }
+
+  if (compiledPath) {
+    unlink(compiledPath);
+    free(compiledPath);
+  }
+
+  if (xmlPath) {
+    if (!*opt_annotationsFile) unlink(xmlPath);
+    free(xmlPath);
+  }
+
+  return ok;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "cldrtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  char directory[] = "/tmp/cldrtest-XXXXXX";
+
+  if (mkdtemp(directory)) {
+    if (testDirectory(directory)) exitStatus = PROG_EXIT_SUCCESS;
+    rmdir(directory);
+  } else {
+    logSystemError("mkdtemp");
+  }
+
+  return exitStatus;
+}
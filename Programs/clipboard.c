@@ -24,14 +24,15 @@
 #include "log.h"
 #include "clipboard.h"
 #include "utf8.h"
-#include "queue.h"
 #include "lock.h"
 #include "program.h"
 #include "api_control.h"
+#include "parameters.h"
 
 typedef struct {
   wchar_t *characters;
   size_t length;
+  uint32_t hash;
 } HistoryEntry;
 
 struct ClipboardObjectStruct {
@@ -42,34 +43,118 @@ struct ClipboardObjectStruct {
   } buffer;
 
   struct {
-    Queue *queue;
+    HistoryEntry **entries; /* the most recent first */
+    unsigned int count;
+    size_t bytes;
   } history;
 };
 
+static inline size_t
+getHistoryEntrySize (const HistoryEntry *entry) {
+  return entry->length * sizeof(*entry->characters);
+}
+
+static uint32_t
+makeHistoryHash (const wchar_t *characters, size_t length) {
+  uint32_t hash = 2166136261U;
+
+  for (size_t index=0; index<length; index+=1) {
+    hash ^= (uint32_t)characters[index];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static void
+deallocateHistoryEntry (HistoryEntry *entry) {
+  if (entry->characters) free(entry->characters);
+  free(entry);
+}
+
+static void
+removeHistoryEntry (ClipboardObject *cpb, unsigned int index) {
+  HistoryEntry *entry = cpb->history.entries[index];
+
+  cpb->history.bytes -= getHistoryEntrySize(entry);
+  cpb->history.count -= 1;
+
+  memmove(&cpb->history.entries[index], &cpb->history.entries[index+1],
+          ARRAY_SIZE(cpb->history.entries, (cpb->history.count - index)));
+
+  deallocateHistoryEntry(entry);
+}
+
+static void
+trimClipboardHistory (ClipboardObject *cpb, unsigned int entryLimit, size_t byteLimit) {
+  while (cpb->history.count > 0) {
+    if (cpb->history.count <= entryLimit) {
+      if (cpb->history.bytes <= byteLimit) {
+        break;
+      }
+    }
+
+    removeHistoryEntry(cpb, cpb->history.count-1);
+  }
+}
+
+static void
+clearClipboardHistory (ClipboardObject *cpb) {
+  trimClipboardHistory(cpb, 0, 0);
+}
+
 const wchar_t *
 getClipboardHistory (ClipboardObject *cpb, unsigned int index, size_t *length) {
-  Element *element = getStackElement(cpb->history.queue, index);
-  if (!element) return NULL;
+  if (index >= cpb->history.count) return NULL;
 
-  const HistoryEntry *entry = getElementItem(element);
+  const HistoryEntry *entry = cpb->history.entries[index];
   *length = entry->length;
   return entry->characters;
 }
 
+static int
+promoteHistoryEntry (ClipboardObject *cpb, const wchar_t *characters, size_t length, uint32_t hash) {
+  for (unsigned int index=0; index<cpb->history.count; index+=1) {
+    HistoryEntry *entry = cpb->history.entries[index];
+
+    if (entry->hash != hash) continue;
+    if (entry->length != length) continue;
+    if (wmemcmp(entry->characters, characters, length) != 0) continue;
+
+    memmove(&cpb->history.entries[1], &cpb->history.entries[0],
+            ARRAY_SIZE(cpb->history.entries, index));
+    cpb->history.entries[0] = entry;
+    return 1;
+  }
+
+  return 0;
+}
+
 int
 addClipboardHistory (ClipboardObject *cpb, const wchar_t *characters, size_t length) {
   if (!length) return 1;
 
-  Queue *queue = cpb->history.queue;
-  Element *element = getStackHead(queue);
+  uint32_t hash = makeHistoryHash(characters, length);
+  if (promoteHistoryEntry(cpb, characters, length, hash)) return 1;
 
-  if (element) {
-    const HistoryEntry *entry = getElementItem(element);
+  {
+    size_t size = length * sizeof(*characters);
 
-    if (length == entry->length) {
-      if (wmemcmp(characters, entry->characters, length) == 0) {
-        return 1;
-      }
+    if (size > CLIPBOARD_HISTORY_BYTE_LIMIT) {
+      logMessage(LOG_DEBUG,
+                 "clipboard history entry too large: %zu > %zu",
+                 size, (size_t)CLIPBOARD_HISTORY_BYTE_LIMIT);
+      return 1;
+    }
+
+    trimClipboardHistory(cpb, CLIPBOARD_HISTORY_ENTRY_LIMIT-1,
+                         CLIPBOARD_HISTORY_BYTE_LIMIT-size);
+  }
+
+  if (!cpb->history.entries) {
+    if (!(cpb->history.entries = malloc(ARRAY_SIZE(cpb->history.entries, CLIPBOARD_HISTORY_ENTRY_LIMIT)))) {
+      logMallocError();
+      return 0;
     }
   }
 
@@ -80,12 +165,14 @@ addClipboardHistory (ClipboardObject *cpb, const wchar_t *characters, size_t len
       if ((entry->characters = allocateCharacters(length))) {
         wmemcpy(entry->characters, characters, length);
         entry->length = length;
+        entry->hash = hash;
 
-        if (enqueueItem(queue, entry)) {
-          return 1;
-        }
-
-        free(entry->characters);
+        memmove(&cpb->history.entries[1], &cpb->history.entries[0],
+                ARRAY_SIZE(cpb->history.entries, cpb->history.count));
+        cpb->history.entries[0] = entry;
+        cpb->history.count += 1;
+        cpb->history.bytes += getHistoryEntrySize(entry);
+        return 1;
       } else {
         logMallocError();
       }
@@ -139,16 +226,17 @@ appendClipboardContent (ClipboardObject *cpb, const wchar_t *characters, size_t
   size_t newLength = cpb->buffer.length + length;
 
   if (newLength > cpb->buffer.size) {
-    size_t newSize = newLength | 0XFF;
-    wchar_t *newCharacters = allocateCharacters(newSize);
+    size_t newSize = cpb->buffer.size? cpb->buffer.size: 0X100;
+    while (newSize < newLength) newSize <<= 1;
+
+    wchar_t *newCharacters = realloc(cpb->buffer.characters,
+                                     ARRAY_SIZE(newCharacters, newSize));
 
     if (!newCharacters) {
       logMallocError();
       return 0;
     }
 
-    wmemcpy(newCharacters, cpb->buffer.characters, cpb->buffer.length);
-    if (cpb->buffer.characters) free(cpb->buffer.characters);
     cpb->buffer.characters = newCharacters;
     cpb->buffer.size = newSize;
   }
@@ -180,13 +268,6 @@ setClipboardContentUTF8 (ClipboardObject *cpb, const char *text) {
   return truncated || appended;
 }
 
-static void
-deallocateClipboardHistoryEntry (void *item, void *data) {
-  HistoryEntry *entry = item;
-  if (entry->characters) free(entry->characters);
-  free(entry);
-}
-
 ClipboardObject *
 newClipboard (void) {
   ClipboardObject *cpb;
@@ -198,9 +279,11 @@ newClipboard (void) {
     cpb->buffer.size = 0;
     cpb->buffer.length = 0;
 
-    if ((cpb->history.queue = newQueue(deallocateClipboardHistoryEntry, NULL))) {
-      return cpb;
-    }
+    cpb->history.entries = NULL;
+    cpb->history.count = 0;
+    cpb->history.bytes = 0;
+
+    return cpb;
   } else {
     logMallocError();
   }
@@ -211,7 +294,8 @@ newClipboard (void) {
 void
 destroyClipboard (ClipboardObject *cpb) {
   if (cpb->buffer.characters) free(cpb->buffer.characters);
-  deallocateQueue(cpb->history.queue);
+  clearClipboardHistory(cpb);
+  if (cpb->history.entries) free(cpb->history.entries);
   free(cpb);
 }
 
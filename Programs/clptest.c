@@ -0,0 +1,239 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* clptest checks that the clipboard history stays within its limits */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "clipboard.h"
+#include "parameters.h"
+#include "api_control.h"
+
+static char *opt_updateCount;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "updates",
+    .letter = 'u',
+    .argument = "count",
+    .setting.string = &opt_updateCount,
+    .internal.setting = "50000",
+    .description = "how many clipboard updates to make"
+  },
+END_OPTION_TABLE
+
+static int updateCount;
+
+static int
+validateOptions (void) {
+  static const int minimum = 100;
+
+  if (!validateInteger(&updateCount, opt_updateCount, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid update count: %s", opt_updateCount);
+    return 0;
+  }
+
+  return 1;
+}
+
+#define TEXT_LENGTH_LIMIT ((CLIPBOARD_HISTORY_BYTE_LIMIT / sizeof(wchar_t)) + 0X100)
+#define REPEAT_WINDOW 0X100
+
+static unsigned long randomState = 1;
+
+static unsigned int
+getRandomNumber (unsigned int limit) {
+  randomState = (randomState * 1103515245) + 12345;
+  return (randomState >> 16) % limit;
+}
+
+/* Each text is determined by its number, so a repeated number means that
+ * the same text is being put onto the clipboard again.
+ */
+static size_t
+makeText (wchar_t *characters, unsigned int number) {
+  size_t length;
+
+  switch (number % 8) {
+    case 0:
+      length = TEXT_LENGTH_LIMIT - (number % 0X100); /* sometimes too large */
+      break;
+
+    case 1:
+    case 2:
+      length = 0X400 + (number % 0X4000);
+      break;
+
+    default:
+      length = 1 + (number % 0X100);
+      break;
+  }
+
+  for (size_t index=0; index<length; index+=1) {
+    characters[index] = WC_C('a') + ((number + index) % 26);
+  }
+
+  /* make texts of the same length and pattern distinct */
+  {
+    size_t index = 0;
+
+    do {
+      characters[index++] = WC_C('0') + (number % 10);
+      number /= 10;
+    } while (number && (index < length));
+  }
+
+  return length;
+}
+
+typedef struct {
+  unsigned int maximumCount;
+  size_t maximumBytes;
+} HistoryUsage;
+
+static int
+checkHistory (ClipboardObject *cpb, const wchar_t *newest, size_t newestLength, HistoryUsage *usage) {
+  unsigned int count = 0;
+  size_t bytes = 0;
+  const wchar_t *characters;
+  size_t length;
+
+  while ((characters = getClipboardHistory(cpb, count, &length))) {
+    for (unsigned int index=0; index<count; index+=1) {
+      size_t otherLength;
+      const wchar_t *other = getClipboardHistory(cpb, index, &otherLength);
+
+      if ((otherLength == length) && (wmemcmp(other, characters, length) == 0)) {
+        logMessage(LOG_ERR, "duplicate clipboard history entries: %u and %u", index, count);
+        return 0;
+      }
+    }
+
+    bytes += length * sizeof(*characters);
+    count += 1;
+  }
+
+  if (count > CLIPBOARD_HISTORY_ENTRY_LIMIT) {
+    logMessage(LOG_ERR, "too many clipboard history entries: %u", count);
+    return 0;
+  }
+
+  if (bytes > CLIPBOARD_HISTORY_BYTE_LIMIT) {
+    logMessage(LOG_ERR, "clipboard history too large: %zu", bytes);
+    return 0;
+  }
+
+  if ((newestLength * sizeof(*newest)) <= CLIPBOARD_HISTORY_BYTE_LIMIT) {
+    characters = getClipboardHistory(cpb, 0, &length);
+
+    if (!characters || (length != newestLength) || (wmemcmp(characters, newest, length) != 0)) {
+      logMessage(LOG_ERR, "newest clipboard content isn't first in the history");
+      return 0;
+    }
+  }
+
+  if (count > usage->maximumCount) usage->maximumCount = count;
+  if (bytes > usage->maximumBytes) usage->maximumBytes = bytes;
+  return 1;
+}
+
+static long int
+getMaximumResidentSize (void) {
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) == -1) return 0;
+  return usage.ru_maxrss;
+}
+
+static int
+testClipboardUpdates (ClipboardObject *cpb) {
+  static wchar_t characters[TEXT_LENGTH_LIMIT];
+  HistoryUsage usage = {.maximumCount = 0};
+  long int warmSize = 0;
+
+  for (int update=1; update<=updateCount; update+=1) {
+    unsigned int number = update;
+
+    /* a quarter of the updates put back a recent text */
+    if ((update > REPEAT_WINDOW) && !getRandomNumber(4)) {
+      number -= 1 + getRandomNumber(REPEAT_WINDOW);
+    }
+
+    size_t length = makeText(characters, number);
+    if (!setClipboardContent(cpb, characters, length)) return 0;
+    if (!clearClipboardContent(cpb)) return 0;
+
+    if (!(update % 0X40) || (update == updateCount)) {
+      if (!checkHistory(cpb, characters, length, &usage)) return 0;
+    }
+
+    if (update == (updateCount / 10)) warmSize = getMaximumResidentSize();
+  }
+
+  long int finalSize = getMaximumResidentSize();
+
+  printf("%d updates: at most %u entries and %zu bytes retained, max RSS %ldKB -> %ldKB\n",
+         updateCount, usage.maximumCount, usage.maximumBytes, warmSize, finalSize);
+
+  /* allow for the allocator's fragmentation, but not for growth */
+  if ((finalSize - warmSize) > ((CLIPBOARD_HISTORY_BYTE_LIMIT * 2) / 1024)) {
+    logMessage(LOG_ERR, "memory use kept growing");
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "clptest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+  ClipboardObject *cpb = newClipboard();
+
+  if (cpb) {
+    if (testClipboardUpdates(cpb)) exitStatus = PROG_EXIT_SUCCESS;
+    destroyClipboard(cpb);
+  }
+
+  return exitStatus;
+}
+
+static void
+testUpdateParameter (brlapi_param_t parameter, brlapi_param_subparam_t subparam) {
+}
+
+const ApiMethods api = {
+  .updateParameter = testUpdateParameter
+};
@@ -21,14 +21,15 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "parameters.h"
 #include "log.h"
 #include "cmd_queue.h"
 #include "cmd_enqueue.h"
 #include "cmd_utils.h"
 #include "brl_cmds.h"
 #include "cmd.h"
-#include "queue.h"
 #include "async_alarm.h"
+#include "latency.h"
 #include "prefs.h"
 #include "ktb_types.h"
 #include "scr.h"
@@ -160,61 +161,50 @@ handleCommand (int command) {
 
 typedef struct {
   int command;
+  LatencyTrace latency;
 } CommandQueueItem;
 
-static void
-deallocateCommandQueueItem (void *item, void *data) {
-  CommandQueueItem *cmd = item;
-
-  free(cmd);
-}
+static struct {
+  unsigned int head;
+  unsigned int count;
+  CommandQueueItem items[COMMAND_QUEUE_SIZE];
+} commandQueue;
 
-static Queue *
-createCommandQueue (void *data) {
-  return newQueue(deallocateCommandQueueItem, NULL);
-}
-
-static Queue *
-getCommandQueue (int create) {
-  static Queue *commands = NULL;
-
-  return getProgramQueue(&commands, "command-queue", create,
-                         createCommandQueue, NULL);
+static CommandQueueItem *
+getCommandQueueItem (unsigned int index) {
+  return &commandQueue.items[(commandQueue.head + index) % COMMAND_QUEUE_SIZE];
 }
 
 static int
-dequeueCommand (Queue *queue) {
-  CommandQueueItem *item;
-
-  if ((item = dequeueItem(queue))) {
-    int command = item->command;
+dequeueCommand (CommandQueueItem *item) {
+  if (!commandQueue.count) return 0;
 
-    free(item);
-    item = NULL;
-
-    return command;
-  }
+  *item = *getCommandQueueItem(0);
+  commandQueue.head = (commandQueue.head + 1) % COMMAND_QUEUE_SIZE;
+  commandQueue.count -= 1;
 
-  return EOF;
+  return 1;
 }
 
 static void setCommandAlarm (void *data);
 static AsyncHandle commandAlarm = NULL;
 
 ASYNC_ALARM_CALLBACK(handleCommandAlarm) {
-  Queue *queue = getCommandQueue(0);
+  CommandEnvironment *env = commandEnvironmentStack;
+  unsigned int limit = COMMAND_QUEUE_BATCH_SIZE;
+  CommandQueueItem item;
 
   asyncDiscardHandle(commandAlarm);
   commandAlarm = NULL;
 
-  if (queue) {
-    int command = dequeueCommand(queue);
+  while (limit-- && dequeueCommand(&item)) {
+    setLatencyTrace(item.latency);
+    traceLatency(item.latency, LATENCY_STAGE_HANDLED);
 
-    if (command != EOF) {
-      command = toPreferredCommand(command);
+    {
+      int command = toPreferredCommand(item.command);
       const CommandEntry *cmd = findCommandEntry(command);
 
-      CommandEnvironment *env = commandEnvironmentStack;
       env->handlingCommand = 1;
 
       void *pre = env->preprocessCommand? env->preprocessCommand(): NULL;
@@ -226,6 +216,12 @@ ASYNC_ALARM_CALLBACK(handleCommandAlarm) {
 
       env->handlingCommand = 0;
     }
+
+    setLatencyTrace(0);
+
+    /* a handler may have changed the environment or suspended the queue */
+    if (env != commandEnvironmentStack) break;
+    if (commandQueueSuspendCount) break;
   }
 
   setCommandAlarm(parameters->data);
@@ -237,9 +233,7 @@ setCommandAlarm (void *data) {
     const CommandEnvironment *env = commandEnvironmentStack;
 
     if (env && !env->handlingCommand) {
-      Queue *queue = getCommandQueue(0);
-
-      if (queue && (getQueueSize(queue) > 0)) {
+      if (commandQueue.count > 0) {
         asyncNewRelativeAlarm(&commandAlarm, 0, handleCommandAlarm, data);
       }
     }
@@ -254,32 +248,52 @@ cancelCommandAlarm (void) {
   }
 }
 
-int
-enqueueCommand (int command) {
+static int
+addCommand (int command, int repeat) {
   if (command == EOF) return 1;
 
-  {
-    Queue *queue = getCommandQueue(1);
+  if (repeat && commandQueue.count) {
+    CommandQueueItem *last = getCommandQueueItem(commandQueue.count - 1);
+
+    /* A repeat of a command which is still waiting to be handled is dropped
+     * so that the queue never runs ahead of the user. Only input that's
+     * marked as a repeat (key table autorepeat, or a driver which knows that
+     * its display is repeating a held key) is ever dropped - a fresh press of
+     * the same key, however quick, is always handled.
+     */
+    if (last->command == command) {
+      logMessage(LOG_LEVEL, "command repeat dropped: %06X", command);
+      return 1;
+    }
+  }
 
-    if (queue) {
-      CommandQueueItem *item = malloc(sizeof(CommandQueueItem));
+  if (commandQueue.count == COMMAND_QUEUE_SIZE) {
+    logMessage(LOG_WARNING, "command queue full: %06X", command);
+    return 0;
+  }
 
-      if (item) {
-        item->command = command;
+  {
+    CommandQueueItem *item = getCommandQueueItem(commandQueue.count);
 
-        if (enqueueItem(queue, item)) {
-          setCommandAlarm(NULL);
-          return 1;
-        }
+    item->command = command;
+    item->latency = getLatencyTrace();
+    traceLatency(item->latency, LATENCY_STAGE_QUEUED);
 
-        free(item);
-      } else {
-        logMallocError();
-      }
-    }
+    commandQueue.count += 1;
   }
 
-  return 0;
+  setCommandAlarm(NULL);
+  return 1;
+}
+
+int
+enqueueCommand (int command) {
+  return addCommand(command, 0);
+}
+
+int
+enqueueRepeatedCommand (int command) {
+  return addCommand(command, 1);
 }
 
 int
@@ -385,6 +399,9 @@ beginCommandQueue (void) {
   commandEnvironmentStack = NULL;
   commandQueueSuspendCount = 0;
 
+  commandQueue.head = 0;
+  commandQueue.count = 0;
+
   return pushCommandEnvironment("initial", NULL, NULL);
 }
 
@@ -0,0 +1,241 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "async_alarm.h"
+#include "async_wait.h"
+#include "cmd_queue.h"
+#include "cmd_enqueue.h"
+#include "brl_cmds.h"
+
+static char *opt_repeatInterval;
+static char *opt_handlingTime;
+static char *opt_holdTime;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "interval",
+    .letter = 'i',
+    .argument = "msecs",
+    .setting.string = &opt_repeatInterval,
+    .internal.setting = "50",
+    .description = "the interval at which the held key repeats"
+  },
+
+  { .word = "handling",
+    .letter = 't',
+    .argument = "msecs",
+    .setting.string = &opt_handlingTime,
+    .internal.setting = "200",
+    .description = "how long it takes to handle each command"
+  },
+
+  { .word = "duration",
+    .letter = 'd',
+    .argument = "msecs",
+    .setting.string = &opt_holdTime,
+    .internal.setting = "2000",
+    .description = "how long the key is held"
+  },
+END_OPTION_TABLE
+
+static int repeatInterval;
+static int handlingTime;
+static int holdTime;
+
+static int
+validateOptions (void) {
+  static const int minimum = 1;
+
+  if (!validateInteger(&repeatInterval, opt_repeatInterval, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid repeat interval: %s", opt_repeatInterval);
+    return 0;
+  }
+
+  if (!validateInteger(&handlingTime, opt_handlingTime, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid handling time: %s", opt_handlingTime);
+    return 0;
+  }
+
+  if (!validateInteger(&holdTime, opt_holdTime, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid hold time: %s", opt_holdTime);
+    return 0;
+  }
+
+  return 1;
+}
+
+typedef struct {
+  int command;
+
+  TimeValue pressed;
+  TimeValue released;
+  AsyncHandle alarm;
+  unsigned int sent;
+
+  unsigned int handled;
+  TimeValue lastHandled;
+} KeyHoldData;
+
+static int
+handleTestCommand (int command, void *data) {
+  KeyHoldData *khd = data;
+
+  if (command == khd->command) {
+    /* handling a command keeps the core busy */
+    approximateDelay(handlingTime);
+
+    khd->handled += 1;
+    getMonotonicTime(&khd->lastHandled);
+  }
+
+  return 1;
+}
+
+/* A display which repeats a held key keeps sending while the core is busy
+ * handling commands. When the core gets back to it, it reads (and enqueues)
+ * all of the repeats which have accumulated since it last looked.
+ */
+ASYNC_ALARM_CALLBACK(handleKeyHoldAlarm) {
+  KeyHoldData *khd = parameters->data;
+  long int elapsed = getMonotonicElapsed(&khd->pressed);
+
+  if (elapsed > holdTime) elapsed = holdTime;
+
+  while (khd->sent <= (elapsed / repeatInterval)) {
+    enqueueRepeatedCommand(khd->command);
+    khd->sent += 1;
+  }
+
+  if (elapsed == holdTime) {
+    getMonotonicTime(&khd->released);
+    asyncCancelRequest(khd->alarm);
+    khd->alarm = NULL;
+  }
+}
+
+static int
+testKeyHold (KeyHoldData *khd) {
+  getMonotonicTime(&khd->pressed);
+  enqueueCommand(khd->command);
+  khd->sent = 1;
+
+  if (asyncNewRelativeAlarm(&khd->alarm, repeatInterval, handleKeyHoldAlarm, khd)) {
+    if (asyncResetAlarmInterval(khd->alarm, repeatInterval)) {
+      /* the key is released once the alarm cancels itself */
+      while (khd->alarm) asyncWait(repeatInterval);
+
+      /* give anything still queued a chance to be handled */
+      asyncWait(handlingTime * 4);
+      return 1;
+    }
+
+    asyncCancelRequest(khd->alarm);
+  }
+
+  return 0;
+}
+
+static int
+testFreshPresses (KeyHoldData *khd, unsigned int count) {
+  suspendCommandQueue();
+
+  for (unsigned int index=0; index<count; index+=1) {
+    enqueueCommand(khd->command);
+  }
+
+  resumeCommandQueue();
+  asyncWait(handlingTime * (count + 1));
+
+  if (khd->handled != count) {
+    logMessage(LOG_ERR, "fresh presses not all handled: %u of %u",
+               khd->handled, count);
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "cmdtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  KeyHoldData khd = {
+    .command = BRL_CMD_LNDN
+  };
+
+  beginCommandQueue();
+
+  if (pushCommandEnvironment("cmdtest", NULL, NULL)) {
+    if (pushCommandHandler("cmdtest", KTB_CTX_DEFAULT,
+                           handleTestCommand, NULL, &khd)) {
+      if (testKeyHold(&khd)) {
+        long int latency = millisecondsBetween(&khd.released, &khd.lastHandled);
+        if (latency < 0) latency = 0;
+
+        printf("key held: %dms, repeats sent: %u, commands handled: %u\n",
+               holdTime, khd.sent, khd.handled);
+        printf("release-to-stop latency: %ldms\n", latency);
+
+        /* at most the command in progress and one queued repeat remain */
+        if (latency > ((handlingTime * 2) + repeatInterval)) {
+          logMessage(LOG_ERR, "command repeats outlived the key: %ldms", latency);
+        } else {
+          khd.handled = 0;
+          if (testFreshPresses(&khd, 5)) exitStatus = PROG_EXIT_SUCCESS;
+        }
+      }
+    }
+
+    popCommandEnvironment();
+  }
+
+  endCommandQueue();
+  return exitStatus;
+}
+
+#include "scr.h"
+
+KeyTableCommandContext
+getScreenCommandContext (void) {
+  return KTB_CTX_DEFAULT;
+}
+
+#include "alert.h"
+
+void
+alert (AlertIdentifier identifier) {
+}
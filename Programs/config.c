@@ -63,6 +63,7 @@
 #include "parse.h"
 #include "dynld.h"
 #include "async_alarm.h"
+#include "uevent.h"
 #include "program.h"
 #include "messages.h"
 #include "revision.h"
@@ -78,6 +79,7 @@
 
 #include "io_generic.h"
 #include "io_usb.h"
+#include "io_serial.h"
 #include "io_bluetooth.h"
 
 #ifdef __MINGW32__
@@ -1104,11 +1106,23 @@ makeBrailleKeyTablePath (void) {
   return makeInputTablePath(opt_tablesDirectory, braille->definition.code, brl.keyBindings);
 }
 
+static int
+generateKeyTableHelpPage (KeyTable *table) {
+  int ok = table? listKeyTable(table, NULL, handleWcharHelpLine, NULL): 1;
+  if (!getHelpLineCount()) addHelpLine(WS_C("help not available"));
+  return ok;
+}
+
+static int
+generateBrailleHelpPage (void *data UNUSED) {
+  return generateKeyTableHelpPage(brl.keyTable);
+}
+
 static void
 makeBrailleHelpPage (const char *keyTablePath) {
   if (enableBrailleHelpPage()) {
     if (brl.keyTable) {
-      listKeyTable(brl.keyTable, NULL, handleWcharHelpLine, NULL);
+      setHelpPageGenerator(generateBrailleHelpPage, NULL);
     } else {
       char *keyHelpPath = replaceFileExtension(keyTablePath, KEY_HELP_EXTENSION);
 
@@ -1121,19 +1135,24 @@ makeBrailleHelpPage (const char *keyTablePath) {
 
         free(keyHelpPath);
       }
-    }
 
-    if (!getHelpLineCount()) {
-      addHelpLine(WS_C("help not available"));
-      message(NULL, gettext("no key bindings"), 0);
+      if (!getHelpLineCount()) {
+        addHelpLine(WS_C("help not available"));
+        message(NULL, gettext("no key bindings"), 0);
+      }
     }
   }
 }
 
+static int
+generateKeyboardHelpPage (void *data UNUSED) {
+  return generateKeyTableHelpPage(keyboardTable);
+}
+
 static void
 makeKeyboardHelpPage (void) {
   if (enableKeyboardHelpPage()) {
-    listKeyTable(keyboardTable, NULL, handleWcharHelpLine, NULL);
+    setHelpPageGenerator(generateKeyboardHelpPage, NULL);
   }
 }
 
@@ -1829,16 +1848,139 @@ stopBrailleDriver (void) {
   alert(ALERT_BRAILLE_OFF);
 }
 
+static ActivityObject *brailleDriverActivity = NULL;
+static UeventListenerInstance *brailleUeventListener = NULL;
+static AsyncHandle brailleDeviceAddedAlarm = NULL;
+static int brailleDriverDisabled = 0;
+
+ASYNC_ALARM_CALLBACK(handleBrailleDeviceAdded) {
+  asyncDiscardHandle(brailleDeviceAddedAlarm);
+  brailleDeviceAddedAlarm = NULL;
+
+  if (!brailleDriverDisabled) enableBrailleDriver();
+}
+
+static int
+testBrailleDeviceUevent (const UeventListenerParameters *parameters) {
+  if (strcmp(parameters->action, "add") != 0) return 0;
+  if (!parameters->subsystem) return 0;
+
+  if (strcmp(parameters->subsystem, "usb") == 0) {
+    const char *product = getUeventProperty(parameters, "PRODUCT");
+    unsigned int vendorIdentifier;
+    unsigned int productIdentifier;
+
+    if (!product) return 0;
+    if (sscanf(product, "%x/%x", &vendorIdentifier, &productIdentifier) != 2) return 0;
+    return !!usbGetDriverCodes(vendorIdentifier, productIdentifier);
+  }
+
+  if (strcmp(parameters->subsystem, "tty") == 0) {
+    const char *name = getUeventProperty(parameters, "DEVNAME");
+
+    if (name && brailleDevices) {
+      const char *const *device = (const char *const *)brailleDevices;
+      size_t nameLength = strlen(name);
+
+      while (*device) {
+        const char *identifier = *device++;
+        size_t identifierLength;
+
+        if (!isSerialDeviceIdentifier(&identifier)) continue;
+        identifierLength = strlen(identifier);
+
+        if (identifierLength < nameLength) continue;
+        if (strcmp(&identifier[identifierLength - nameLength], name) != 0) continue;
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
+UEVENT_LISTENER(handleBrailleDeviceUevent) {
+  if (brailleDriverDisabled) return;
+
+  if (testBrailleDeviceUevent(parameters)) {
+    if (brailleDriverActivity && !isActivityStarted(brailleDriverActivity)) {
+      if (!brailleDeviceAddedAlarm) {
+        logMessage(LOG_DEBUG, "braille device added: %s", parameters->device);
+
+        asyncNewRelativeAlarm(&brailleDeviceAddedAlarm, BRAILLE_DRIVER_DEVICE_ADDED_DELAY,
+                              handleBrailleDeviceAdded, NULL);
+      }
+    }
+  }
+}
+
+static int
+canMonitorBrailleDevices (void) {
+  const char *const *device = (const char *const *)brailleDevices;
+  if (!device) return 0;
+
+  while (*device) {
+    const char *identifier = *device++;
+
+    if (isUsbDeviceIdentifier(&identifier)) continue;
+    if (isSerialDeviceIdentifier(&identifier)) continue;
+    return 0;
+  }
+
+  return 1;
+}
+
+/* The start retry is only stretched while hot-plug events are being
+ * received. It's checked again after each failed start so that a uevent
+ * monitor which has been lost doesn't leave the display undetected.
+ */
+static void
+setBrailleDriverRetryInterval (void) {
+  int interval = 0;
+
+  if (brailleUeventListener && isUeventMonitorActive() && canMonitorBrailleDevices()) {
+    interval = BRAILLE_DRIVER_START_UEVENT_RETRY_INTERVAL;
+  }
+
+  setActivityRetryInterval(brailleDriverActivity, interval);
+}
+
+static void
+monitorBrailleDevices (void) {
+  if (!brailleUeventListener) {
+    brailleUeventListener = registerUeventListener(NULL, handleBrailleDeviceUevent, NULL);
+  }
+
+  setBrailleDriverRetryInterval();
+}
+
+static void
+unmonitorBrailleDevices (void) {
+  if (brailleDeviceAddedAlarm) {
+    asyncCancelRequest(brailleDeviceAddedAlarm);
+    brailleDeviceAddedAlarm = NULL;
+  }
+
+  if (brailleUeventListener) {
+    unregisterUeventListener(brailleUeventListener);
+    brailleUeventListener = NULL;
+  }
+}
+
 static int
 prepareBrailleDriverActivity (void *data) {
   initializeBrailleDisplay();
   ensureBrailleBuffer(&brl, LOG_DEBUG);
+  monitorBrailleDevices();
   return 1;
 }
 
 static int
 startBrailleDriverActivity (void *data) {
-  return startBrailleDriver();
+  if (startBrailleDriver()) return 1;
+
+  setBrailleDriverRetryInterval();
+  return 0;
 }
 
 static void
@@ -1855,8 +1997,6 @@ static const ActivityMethods brailleDriverActivityMethods = {
   .stop = stopBrailleDriverActivity
 };
 
-static ActivityObject *brailleDriverActivity = NULL;
-
 static void
 writeBrailleMessage (const char *text) {
   clearStatusCells(&brl);
@@ -1878,6 +2018,8 @@ exitBrailleDriver (void *data) {
     writeBrailleMessage(text);
   }
 
+  unmonitorBrailleDevices();
+
   if (brailleDriverActivity) {
     destroyActivity(brailleDriverActivity);
     brailleDriverActivity = NULL;
@@ -1906,6 +2048,8 @@ static int canEnableBrailleDriver = 1;
 void
 enableBrailleDriver (void) {
   if (canEnableBrailleDriver) {
+    brailleDriverDisabled = 0;
+
     ActivityObject *activity = getBrailleDriverActivity(1);
     if (activity) startActivity(activity);
   }
@@ -1915,6 +2059,14 @@ void
 disableBrailleDriver (const char *reason) {
   ActivityObject *activity = getBrailleDriverActivity(0);
 
+  /* don't let a newly added device restart a driver that was stopped on purpose */
+  brailleDriverDisabled = 1;
+
+  if (brailleDeviceAddedAlarm) {
+    asyncCancelRequest(brailleDeviceAddedAlarm);
+    brailleDeviceAddedAlarm = NULL;
+  }
+
   if (activity) {
     if (reason) writeBrailleMessage(reason);
     stopActivity(activity);
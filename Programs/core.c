@@ -71,6 +71,7 @@
 #include "brl_utils.h"
 #include "prefs.h"
 #include "api_control.h"
+#include "latency.h"
 #include "core.h"
 
 #ifdef ENABLE_SPEECH_SUPPORT
@@ -1501,7 +1502,7 @@ runCoreTask (CoreTaskCallback *callback, void *data, int wait) {
       ctd->wait.event = NULL;
       ctd->wait.finished = 0;
 
-      if (!wait || (ctd->wait.event = asyncNewEvent(setCoreTaskFinished, NULL))) {
+      if (!wait || (ctd->wait.event = asyncNewLimitedEvent(setCoreTaskFinished, NULL, 1))) {
         logCoreTaskAction(callback, "scheduling");
 
         if (asyncAddTask(addCoreTaskEvent, handleCoreTask, ctd)) {
@@ -1557,6 +1558,20 @@ ASYNC_SIGNAL_HANDLER(handleChildDeath) {
 #endif /* SIGCHLD */
 #endif /* ASYNC_CAN_HANDLE_SIGNALS */
 
+#ifdef ENABLE_LATENCY_TRACING
+static void
+exitLatencyTracing (void *data) {
+  logLatencyStatistics();
+}
+
+#if defined(ASYNC_CAN_MONITOR_SIGNALS) && defined(SIGQUIT)
+static ASYNC_SIGNAL_CALLBACK(handleLatencyStatisticsRequest) {
+  logLatencyStatistics();
+  return 1;
+}
+#endif /* defined(ASYNC_CAN_MONITOR_SIGNALS) && defined(SIGQUIT) */
+#endif /* ENABLE_LATENCY_TRACING */
+
 ProgramExitStatus
 brlttyConstruct (int argc, char *argv[]) {
   {
@@ -1599,6 +1614,12 @@ brlttyConstruct (int argc, char *argv[]) {
 #endif /* SIGCHLD */
 #endif /* ASYNC_CAN_HANDLE_SIGNALS */
 
+#ifdef ENABLE_LATENCY_TRACING
+#if defined(ASYNC_CAN_MONITOR_SIGNALS) && defined(SIGQUIT)
+  asyncMonitorSignal(NULL, SIGQUIT, handleLatencyStatisticsRequest, NULL);
+#endif /* defined(ASYNC_CAN_MONITOR_SIGNALS) && defined(SIGQUIT) */
+#endif /* ENABLE_LATENCY_TRACING */
+
   interruptEnabledCount = 0;
   interruptEvent = NULL;
   interruptPending = 0;
@@ -1616,6 +1637,10 @@ brlttyConstruct (int argc, char *argv[]) {
   }
 
   onProgramExit("sessions", exitSessions, NULL);
+
+#ifdef ENABLE_LATENCY_TRACING
+  onProgramExit("latency", exitLatencyTracing, NULL);
+#endif /* ENABLE_LATENCY_TRACING */
   setSessionEntry();
   ses->trkx = scr.posx; ses->trky = scr.posy;
   if (!trackScreenCursor(1)) ses->winx = ses->winy = 0;
@@ -832,6 +832,9 @@ startContractionCommand (ContractionTable *table) {
     logMessage(LOG_DEBUG, "external contraction table started: %s", table->data.external.command);
 
     table->data.external.commandStarted = 1;
+    table->data.external.binary.offered = 0;
+    table->data.external.binary.accepted = 0;
+    table->data.external.binary.active = 0;
   }
 
   return 1;
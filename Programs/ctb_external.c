@@ -20,6 +20,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <limits.h>
 
 #include "log.h"
 #include "ctb_translate.h"
@@ -84,6 +85,12 @@ putExternalRequests (BrailleContractionData *bcd) {
   FILE *stream = bcd->table->data.external.standardInput;
   const ExternalRequestEntry *req = externalRequestTable;
 
+  if (!bcd->table->data.external.binary.offered) {
+    /* a helper which doesn't know about this property just ignores it */
+    if (fputs("protocols=binary\n", stream) == EOF) goto outputError;
+    bcd->table->data.external.binary.offered = 1;
+  }
+
   while (req->name) {
     if (fputs(req->name, stream) == EOF) goto outputError;
     if (fputc('=', stream) == EOF) goto outputError;
@@ -215,10 +222,7 @@ handleExternalResponse_brf (BrailleContractionData *bcd, const char *value) {
 }
 
 static int
-handleExternalResponse_consumedLength (BrailleContractionData *bcd, const char *value) {
-  int length;
-
-  if (!isInteger(&length, value)) return 0;
+setConsumedLength (BrailleContractionData *bcd, int length) {
   if (length < 1) return 0;
   if (length > getInputCount(bcd)) return 0;
 
@@ -226,6 +230,24 @@ handleExternalResponse_consumedLength (BrailleContractionData *bcd, const char *
   return 1;
 }
 
+static int
+setOutputOffset (BrailleContractionData *bcd, unsigned int index, int offset, int *previous) {
+  if (offset < ((index == 0)? 0: *previous)) return 0;
+  if (offset >= getOutputCount(bcd)) return 0;
+
+  bcd->input.offsets[index] = (offset == *previous)? CTB_NO_OFFSET: offset;
+  *previous = offset;
+  return 1;
+}
+
+static int
+handleExternalResponse_consumedLength (BrailleContractionData *bcd, const char *value) {
+  int length;
+
+  if (!isInteger(&length, value)) return 0;
+  return setConsumedLength(bcd, length);
+}
+
 static int
 handleExternalResponse_outputOffsets (BrailleContractionData *bcd, const char *value) {
   if (bcd->input.offsets) {
@@ -258,17 +280,22 @@ handleExternalResponse_outputOffsets (BrailleContractionData *bcd, const char *v
         }
       }
 
-      if (offset < ((index == 0)? 0: previous)) return 0;
-      if (offset >= getOutputCount(bcd)) return 0;
-
-      bcd->input.offsets[index++] = (offset == previous)? CTB_NO_OFFSET: offset;
-      previous = offset;
+      if (!setOutputOffset(bcd, index++, offset, &previous)) return 0;
     }
   }
 
   return 1;
 }
 
+static int
+handleExternalResponse_protocol (BrailleContractionData *bcd, const char *value) {
+  if (strcmp(value, "binary") != 0) return 0;
+
+  logMessage(LOG_DEBUG, "external contraction table accepted binary protocol: %s", bcd->table->data.external.command);
+  bcd->table->data.external.binary.accepted = 1;
+  return 1;
+}
+
 typedef struct {
   const char *name;
   int (*handler) (BrailleContractionData *bcd, const char *value);
@@ -289,6 +316,10 @@ static const ExternalResponseEntry externalResponseTable[] = {
     .handler = handleExternalResponse_outputOffsets
   },
 
+  { .name = "protocol",
+    .handler = handleExternalResponse_protocol
+  },
+
   { .name = NULL }
 };
 
@@ -329,20 +360,154 @@ getExternalResponses (BrailleContractionData *bcd) {
   return 0;
 }
 
+/* The binary protocol is offered (via "protocols=binary") with the first text
+ * request, and a helper which supports it says so (via "protocol=binary")
+ * within its response to that request. All subsequent requests are then
+ * framed as follows, every number being an unsigned 32-bit big-endian integer:
+ *
+ * request: the line count, expand-current-word, capitalization-mode,
+ *          and then, for each line: cursor-position, maximum-length,
+ *          the length (in bytes) of the text, and the text (UTF-8)
+ *
+ * response (for each line): consumed-length (0 if all), the number of cells,
+ *                           the cells (BRF), the number of output offsets,
+ *                           and the output offsets
+ *
+ * Lines aren't batched: contractText() translates one line at a time and
+ * nothing queues lines for it, so the line count is always 1. It's in the
+ * frame so that helpers won't need to change if batching is ever added.
+ */
+
+static int
+putBinaryNumber (FILE *stream, uint32_t number) {
+  const unsigned char bytes[] = {
+    number >> 24, number >> 16, number >> 8, number
+  };
+
+  return fwrite(bytes, 1, sizeof(bytes), stream) == sizeof(bytes);
+}
+
+static int
+getBinaryNumber (FILE *stream, uint32_t *number) {
+  unsigned char bytes[4];
+
+  if (fread(bytes, 1, sizeof(bytes), stream) != sizeof(bytes)) return 0;
+  *number = (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+  return 1;
+}
+
+static int
+putBinaryRequest (BrailleContractionData *bcd) {
+  ContractionTable *table = bcd->table;
+  FILE *stream = table->data.external.standardInput;
+
+  unsigned int length = getInputCount(bcd);
+  char text[(length * UTF8_LEN_MAX) + 1];
+  size_t size = 0;
+
+  for (unsigned int offset=0; offset<length; offset+=1) {
+    size_t utfs = convertWcharToUtf8(bcd->input.begin[offset], &text[size]);
+
+    if (!utfs) return 0;
+    size += utfs;
+  }
+
+  if (!putBinaryNumber(stream, 1)) goto outputError;
+  if (!putBinaryNumber(stream, prefs.expandCurrentWord)) goto outputError;
+  if (!putBinaryNumber(stream, prefs.capitalizationMode)) goto outputError;
+
+  if (!putBinaryNumber(stream, bcd->input.cursor? bcd->input.cursor-bcd->input.begin+1: 0)) goto outputError;
+  if (!putBinaryNumber(stream, getOutputCount(bcd))) goto outputError;
+  if (!putBinaryNumber(stream, size)) goto outputError;
+  if (fwrite(text, 1, size, stream) != size) goto outputError;
+
+  if (fflush(stream) == EOF) goto outputError;
+  return 1;
+
+outputError:
+  logMessage(LOG_WARNING, "external contraction output error: %s: %s", table->data.external.command, strerror(errno));
+  return 0;
+}
+
+static int
+readBinaryResponse (BrailleContractionData *bcd) {
+  FILE *stream = bcd->table->data.external.standardOutput;
+  int ok = 1;
+  uint32_t number;
+
+  if (!getBinaryNumber(stream, &number)) return -1;
+  if (number && !setConsumedLength(bcd, number)) ok = 0;
+
+  if (!getBinaryNumber(stream, &number)) return -1;
+  if (number > 0XFFFF) return -1;
+
+  {
+    char brf[number + 1];
+
+    if (fread(brf, 1, number, stream) != number) return -1;
+    brf[number] = 0;
+    if (!handleExternalResponse_brf(bcd, brf)) ok = 0;
+  }
+
+  if (!getBinaryNumber(stream, &number)) return -1;
+  if (number > getInputCount(bcd)) return -1;
+
+  {
+    int previous = CTB_NO_OFFSET;
+
+    for (unsigned int index=0; index<number; index+=1) {
+      uint32_t offset;
+
+      if (!getBinaryNumber(stream, &offset)) return -1;
+      if (!bcd->input.offsets) continue;
+      if (offset > INT_MAX) ok = 0;
+      if (ok && !setOutputOffset(bcd, index, offset, &previous)) ok = 0;
+    }
+  }
+
+  return ok;
+}
+
+static int
+getBinaryResponse (BrailleContractionData *bcd) {
+  ContractionTable *table = bcd->table;
+  int result = readBinaryResponse(bcd);
+
+  if (result < 0) {
+    logMessage(LOG_WARNING, "incomplete external contraction response: %s", table->data.external.command);
+    return 0;
+  }
+
+  if (!result) {
+    logMessage(LOG_WARNING, "unexpected external contraction response: %s", table->data.external.command);
+  }
+
+  return 1;
+}
+
 static int
 contractText_external (BrailleContractionData *bcd) {
+  ContractionTable *table = bcd->table;
+
   setOffset(bcd);
   while (++bcd->input.current < bcd->input.end) clearOffset(bcd);
 
-  if (startContractionCommand(bcd->table)) {
-    if (putExternalRequests(bcd)) {
+  if (startContractionCommand(table)) {
+    if (table->data.external.binary.active) {
+      if (putBinaryRequest(bcd)) {
+        if (getBinaryResponse(bcd)) {
+          return 1;
+        }
+      }
+    } else if (putExternalRequests(bcd)) {
       if (getExternalResponses(bcd)) {
+        if (table->data.external.binary.accepted) table->data.external.binary.active = 1;
         return 1;
       }
     }
   }
 
-  stopContractionCommand(bcd->table);
+  stopContractionCommand(table);
   return 0;
 }
 
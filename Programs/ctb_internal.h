@@ -187,6 +187,12 @@ struct ContractionTableStruct {
       FILE *standardOutput;
       unsigned commandStarted:1;
 
+      struct {
+        unsigned offered:1;
+        unsigned accepted:1;
+        unsigned active:1;
+      } binary;
+
       struct {
         char *buffer;
         size_t size;
@@ -921,11 +921,19 @@ contractText_native (BrailleContractionData *bcd) {
       if (bcd->current.opcode == CTO_Replace) {
         const ContractionTableRule *rule = bcd->current.rule;
 
-        size_t size = rule->replen + 1;
-        wchar_t characters[size];
+        /* the replacement isn't terminated so its length must bound the
+         * conversion - whatever follows it in the table isn't part of it
+         */
+        size_t utfs = rule->replen;
+        wchar_t characters[utfs];
         wchar_t *to = characters;
         const char *from = (const char *)&rule->findrep[rule->findlen];
-        convertUtf8ToWchars(&from, &to, size);
+
+        while (utfs) {
+          wint_t character = convertUtf8ToWchar(&from, &utfs);
+          if (character == WEOF) break;
+          *to++ = character;
+        }
 
         const wchar_t *inputBuffer = characters;
         int inputLength = to - characters;
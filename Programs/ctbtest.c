@@ -0,0 +1,362 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* ctbtest compares the text and binary external contraction protocols */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "ctb.h"
+
+static char *opt_lineCount;
+static char *opt_outputWidth;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "lines",
+    .letter = 'n',
+    .argument = "count",
+    .setting.string = &opt_lineCount,
+    .internal.setting = "20000",
+    .description = "how many lines to contract with each protocol"
+  },
+
+  { .word = "width",
+    .letter = 'w',
+    .argument = "cells",
+    .setting.string = &opt_outputWidth,
+    .internal.setting = "40",
+    .description = "the maximum length of each contracted line"
+  },
+END_OPTION_TABLE
+
+static int lineCount;
+static int outputWidth;
+
+static int
+validateOptions (void) {
+  static const int minimum = 1;
+
+  if (!validateInteger(&lineCount, opt_lineCount, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid line count: %s", opt_lineCount);
+    return 0;
+  }
+
+  if (!validateInteger(&outputWidth, opt_outputWidth, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid output width: %s", opt_outputWidth);
+    return 0;
+  }
+
+  return 1;
+}
+
+/* When started as an external contraction table, this program is a stand-in
+ * helper. Its only contraction is "the" (BRF "!"). The environment variable
+ * says which protocol it should speak: text, or binary if it's offered.
+ */
+#define HELPER_VARIABLE "CTBTEST_HELPER"
+#define HELPER_LINE_LIMIT 0X400
+
+typedef struct {
+  unsigned int cursor;
+  unsigned int maximum;
+  size_t length;
+  char text[HELPER_LINE_LIMIT];
+
+  unsigned int consumed;
+  unsigned int cellCount;
+  char cells[HELPER_LINE_LIMIT];
+  unsigned int offsets[HELPER_LINE_LIMIT];
+} HelperLine;
+
+static void
+contractHelperLine (HelperLine *line) {
+  unsigned int index = 0;
+
+  line->cellCount = 0;
+
+  while ((index < line->length) && (line->cellCount < line->maximum)) {
+    unsigned int count = 1;
+    char cell = line->text[index];
+
+    if (strncmp(&line->text[index], "the", 3) == 0) {
+      count = 3;
+      cell = '!';
+    }
+
+    while (count-- && (index < line->length)) {
+      line->offsets[index++] = line->cellCount;
+    }
+
+    line->cells[line->cellCount++] = cell;
+  }
+
+  line->consumed = index;
+}
+
+static int
+getHelperNumber (uint32_t *number) {
+  unsigned char bytes[4];
+
+  if (fread(bytes, 1, sizeof(bytes), stdin) != sizeof(bytes)) return 0;
+  *number = (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+  return 1;
+}
+
+static void
+putHelperNumber (uint32_t number) {
+  const unsigned char bytes[] = {
+    number >> 24, number >> 16, number >> 8, number
+  };
+
+  fwrite(bytes, 1, sizeof(bytes), stdout);
+}
+
+static int
+serveBinaryRequest (HelperLine *line) {
+  uint32_t count, expand, capitalization;
+
+  if (!getHelperNumber(&count)) return 0;
+  if (!getHelperNumber(&expand)) return 0;
+  if (!getHelperNumber(&capitalization)) return 0;
+
+  while (count--) {
+    uint32_t cursor, maximum, size;
+
+    if (!getHelperNumber(&cursor)) return 0;
+    if (!getHelperNumber(&maximum)) return 0;
+    if (!getHelperNumber(&size)) return 0;
+    if (size >= sizeof(line->text)) return 0;
+    if (fread(line->text, 1, size, stdin) != size) return 0;
+
+    line->cursor = cursor;
+    line->maximum = maximum;
+    line->length = size;
+    contractHelperLine(line);
+
+    putHelperNumber((line->consumed < line->length)? line->consumed: 0);
+    putHelperNumber(line->cellCount);
+    fwrite(line->cells, 1, line->cellCount, stdout);
+    putHelperNumber(line->consumed);
+
+    for (unsigned int index=0; index<line->consumed; index+=1) {
+      putHelperNumber(line->offsets[index]);
+    }
+  }
+
+  return fflush(stdout) != EOF;
+}
+
+static int
+serveTextRequest (HelperLine *line, int *binary) {
+  char buffer[HELPER_LINE_LIMIT + 0X20];
+  int offered = 0;
+
+  while (fgets(buffer, sizeof(buffer), stdin)) {
+    char *value = strchr(buffer, '=');
+    if (!value) continue;
+    *value++ = 0;
+
+    {
+      size_t length = strlen(value);
+      if (length && (value[length-1] == '\n')) value[--length] = 0;
+    }
+
+    if (strcmp(buffer, "protocols") == 0) {
+      offered = strcmp(value, "binary") == 0;
+    } else if (strcmp(buffer, "cursor-position") == 0) {
+      line->cursor = atoi(value);
+    } else if (strcmp(buffer, "maximum-length") == 0) {
+      line->maximum = atoi(value);
+    } else if (strcmp(buffer, "text") == 0) {
+      line->length = strlen(value);
+      memcpy(line->text, value, line->length);
+      contractHelperLine(line);
+
+      if (line->consumed < line->length) printf("consumed-length=%u\n", line->consumed);
+      printf("output-offsets=");
+
+      for (unsigned int index=0; index<line->consumed; index+=1) {
+        printf("%s%u", (index? ",": ""), line->offsets[index]);
+      }
+
+      printf("\n");
+
+      if (offered && *binary) {
+        printf("protocol=binary\n");
+      } else {
+        *binary = 0;
+      }
+
+      printf("brf=%.*s\n", line->cellCount, line->cells);
+      return fflush(stdout) != EOF;
+    }
+  }
+
+  return 0;
+}
+
+static int
+runHelper (const char *protocol) {
+  static HelperLine line;
+  int binary = strcmp(protocol, "binary") == 0;
+
+  if (!serveTextRequest(&line, &binary)) return PROG_EXIT_SUCCESS;
+
+  while (binary? serveBinaryRequest(&line): serveTextRequest(&line, &binary));
+  return PROG_EXIT_SUCCESS;
+}
+
+typedef struct {
+  int inputLength;
+  int outputLength;
+  unsigned char *cells;
+  int *offsets;
+} LineResult;
+
+static void
+makeTestLine (wchar_t *characters, int length, unsigned int number) {
+  char text[0X100];
+  int size = snprintf(text, sizeof(text),
+                      "%u: the quick brown fox jumps over the lazy dog, then the next one does",
+                      number);
+
+  for (int index=0; index<length; index+=1) {
+    characters[index] = (index < size)? text[index]: ' ';
+  }
+}
+
+static int
+contractTestLines (const char *helper, const char *protocol, LineResult *results, long int *time) {
+  ContractionTable *table;
+
+  if (setenv(HELPER_VARIABLE, protocol, 1) == -1) {
+    logSystemError("setenv");
+    return 0;
+  }
+
+  if (!(table = compileContractionTable(helper))) return 0;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  for (int index=0; index<lineCount; index+=1) {
+    LineResult *result = &results[index];
+    const int length = 80;
+    wchar_t characters[length];
+
+    makeTestLine(characters, length, index);
+    result->inputLength = length;
+    result->outputLength = outputWidth;
+
+    contractText(table, characters, &result->inputLength,
+                 result->cells, &result->outputLength,
+                 result->offsets, (index % length));
+  }
+
+  *time = getMonotonicElapsed(&start);
+  destroyContractionTable(table);
+  return 1;
+}
+
+static int
+allocateResults (LineResult *results) {
+  for (int index=0; index<lineCount; index+=1) {
+    LineResult *result = &results[index];
+
+    if (!(result->cells = malloc(outputWidth))) return 0;
+    if (!(result->offsets = malloc(ARRAY_SIZE(result->offsets, 80)))) return 0;
+  }
+
+  return 1;
+}
+
+static int
+compareResults (const LineResult *text, const LineResult *binary) {
+  for (int index=0; index<lineCount; index+=1) {
+    const LineResult *t = &text[index];
+    const LineResult *b = &binary[index];
+
+    if ((t->inputLength != b->inputLength) ||
+        (t->outputLength != b->outputLength) ||
+        (memcmp(t->cells, b->cells, t->outputLength) != 0) ||
+        (memcmp(t->offsets, b->offsets, ARRAY_SIZE(t->offsets, t->inputLength)) != 0)) {
+      logMessage(LOG_ERR, "line %d differs between protocols", index);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    const char *protocol = getenv(HELPER_VARIABLE);
+    if (protocol) return runHelper(protocol);
+  }
+
+  /* the helper is this program, started as an external contraction table */
+  const char *programPath = argv[0];
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "ctbtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  char helper[PATH_MAX];
+  LineResult *textResults = calloc(lineCount, sizeof(*textResults));
+  LineResult *binaryResults = calloc(lineCount, sizeof(*binaryResults));
+
+  if (!realpath(programPath, helper)) {
+    logSystemError("realpath");
+  } else if (!textResults || !binaryResults ||
+             !allocateResults(textResults) || !allocateResults(binaryResults)) {
+    logMallocError();
+  } else {
+    long int textTime, binaryTime;
+
+    if (contractTestLines(helper, "text", textResults, &textTime) &&
+        contractTestLines(helper, "binary", binaryResults, &binaryTime)) {
+      printf("%d lines: text %ldms (%ld lines/s), binary %ldms (%ld lines/s)\n",
+             lineCount,
+             textTime, (lineCount * 1000L) / (textTime + 1),
+             binaryTime, (lineCount * 1000L) / (binaryTime + 1));
+
+      if (compareResults(textResults, binaryResults)) exitStatus = PROG_EXIT_SUCCESS;
+    }
+  }
+
+  return exitStatus;
+}
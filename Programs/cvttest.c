@@ -0,0 +1,251 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* cvttest compares charset conversion with what iconv itself returns */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <iconv.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "charset.h"
+#include "unicode.h"
+
+static char *opt_characterCount;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "characters",
+    .letter = 'c',
+    .argument = "count",
+    .setting.string = &opt_characterCount,
+    .internal.setting = "2000000",
+    .description = "how many characters to convert each way"
+  },
+END_OPTION_TABLE
+
+static int characterCount;
+
+static int
+validateOptions (void) {
+  static const int minimum = 0X100;
+
+  if (!validateInteger(&characterCount, opt_characterCount, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid character count: %s", opt_characterCount);
+    return 0;
+  }
+
+  return 1;
+}
+
+static const char *const defaultCharsets[] = {
+  "ISO-8859-1",
+  "ISO-8859-2",
+  "ISO-8859-15",
+  "CP1252",
+  "KOI8-R",
+  "CP437",
+  "UTF-8"
+};
+
+typedef struct {
+  iconv_t toWchar;
+  iconv_t toChar;
+} ReferenceConverter;
+
+/* This is how each character used to be converted. */
+static wint_t
+convertCharToWcharWithReference (ReferenceConverter *reference, char c) {
+  char *fp = &c;
+  size_t fs = sizeof(c);
+
+  wchar_t wc;
+  wchar_t *tp = &wc;
+  size_t ts = sizeof(wc);
+
+  if (iconv(reference->toWchar, &fp, &fs, (void *)&tp, &ts) != (size_t)-1) return wc;
+  iconv(reference->toWchar, NULL, NULL, NULL, NULL);
+  return WEOF;
+}
+
+static int
+convertWcharToCharWithReference (ReferenceConverter *reference, wchar_t wc) {
+  wchar_t *fp = &wc;
+  size_t fs = sizeof(wc);
+
+  unsigned char c;
+  unsigned char *tp = &c;
+  size_t ts = sizeof(c);
+
+  if (iconv(reference->toChar, (void *)&fp, &fs, (void *)&tp, &ts) != (size_t)-1) return c;
+  iconv(reference->toChar, NULL, NULL, NULL, NULL);
+  return EOF;
+}
+
+static int
+verifyConversions (ReferenceConverter *reference, const char *charset) {
+  for (unsigned int byte=0; byte<0X100; byte+=1) {
+    wint_t expected = convertCharToWcharWithReference(reference, byte);
+    wint_t actual = convertCharToWchar(byte);
+
+    if (actual != expected) {
+      logMessage(LOG_ERR, "%s: byte %02X converted differently: %lX != %lX",
+                 charset, byte, (unsigned long)actual, (unsigned long)expected);
+      return 0;
+    }
+  }
+
+  for (wchar_t wc=0; wc<0X3000; wc+=1) {
+    if ((wc >= UNICODE_SURROGATE_BEGIN) && (wc <= UNICODE_SURROGATE_END)) continue;
+
+    int expected = convertWcharToCharWithReference(reference, wc);
+    int actual = convertWcharToChar(wc);
+
+    if (actual != expected) {
+      logMessage(LOG_ERR, "%s: character U+%04lX converted differently: %d != %d",
+                 charset, (unsigned long)wc, actual, expected);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static long int
+getNanosecondsPerCharacter (long int milliseconds) {
+  return (long int)(((long long int)milliseconds * 1000000) / characterCount);
+}
+
+static void
+measureConversions (ReferenceConverter *reference, const char *charset, char *chars, wchar_t *characters) {
+  TimeValue start;
+  long int tableToWchar, tableToChar, iconvToWchar, iconvToChar;
+
+  for (int index=0; index<characterCount; index+=1) {
+    /* the printable ASCII and upper half characters which are on the screen */
+    chars[index] = 0X20 + (index % 0XE0);
+  }
+
+  getMonotonicTime(&start);
+  convertCharsToWchars(chars, characters, characterCount, UNICODE_REPLACEMENT_CHARACTER);
+  tableToWchar = getMonotonicElapsed(&start);
+
+  getMonotonicTime(&start);
+  convertWcharsToChars(characters, chars, characterCount, '?');
+  tableToChar = getMonotonicElapsed(&start);
+
+  getMonotonicTime(&start);
+  for (int index=0; index<characterCount; index+=1) {
+    wint_t wc = convertCharToWcharWithReference(reference, chars[index]);
+    characters[index] = (wc == WEOF)? UNICODE_REPLACEMENT_CHARACTER: wc;
+  }
+  iconvToWchar = getMonotonicElapsed(&start);
+
+  getMonotonicTime(&start);
+  for (int index=0; index<characterCount; index+=1) {
+    int c = convertWcharToCharWithReference(reference, characters[index]);
+    chars[index] = (c == EOF)? '?': c;
+  }
+  iconvToChar = getMonotonicElapsed(&start);
+
+  printf("%s: char->wchar %ldns (iconv %ldns), wchar->char %ldns (iconv %ldns) per character\n",
+         charset,
+         getNanosecondsPerCharacter(tableToWchar), getNanosecondsPerCharacter(iconvToWchar),
+         getNanosecondsPerCharacter(tableToChar), getNanosecondsPerCharacter(iconvToChar));
+}
+
+static int
+testCharset (const char *charset, char *chars, wchar_t *characters) {
+  if (!setCharset(charset)) {
+    logMessage(LOG_ERR, "charset not supported: %s", charset);
+    return 0;
+  }
+
+  ReferenceConverter reference;
+  int ok = 0;
+
+  if ((reference.toWchar = iconv_open(getWcharCharset(), charset)) != (iconv_t)-1) {
+    if ((reference.toChar = iconv_open(charset, getWcharCharset())) != (iconv_t)-1) {
+      if (verifyConversions(&reference, charset)) {
+        measureConversions(&reference, charset, chars, characters);
+        ok = 1;
+      }
+
+      iconv_close(reference.toChar);
+    } else {
+      logSystemError("iconv_open");
+    }
+
+    iconv_close(reference.toWchar);
+  } else {
+    logSystemError("iconv_open");
+  }
+
+  return ok;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "cvttest",
+      .argumentsSummary = "[charset ...]"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  char *chars = malloc(characterCount);
+  wchar_t *characters = malloc(characterCount * sizeof(*characters));
+
+  if (chars && characters) {
+    const char *const *charset = defaultCharsets;
+    const char *const *end = charset + ARRAY_COUNT(defaultCharsets);
+
+    if (argc) {
+      charset = (const char *const *)argv;
+      end = charset + argc;
+    }
+
+    exitStatus = PROG_EXIT_SUCCESS;
+
+    while (charset < end) {
+      if (!testCharset(*charset++, chars, characters)) {
+        exitStatus = PROG_EXIT_FATAL;
+        break;
+      }
+    }
+  } else {
+    logMallocError();
+  }
+
+  if (characters) free(characters);
+  if (chars) free(chars);
+  return exitStatus;
+}
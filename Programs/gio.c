@@ -33,6 +33,7 @@ const GioProperties *const gioProperties[] = {
   &gioProperties_serial,
   &gioProperties_usb,
   &gioProperties_bluetooth,
+  &gioProperties_replay,
   NULL
 };
 
@@ -461,7 +462,7 @@ gioGetHidReportSize (GioEndpoint *endpoint, unsigned char report) {
       return 0;
     }
 
-    return method(&endpoint->hidReportItems, report);
+    return method(endpoint->handle, &endpoint->hidReportItems, report);
   }
 }
 
@@ -652,3 +653,15 @@ gioGetResourceObject (GioEndpoint *endpoint) {
   logUnsupportedOperation("getResourceObject");
   return NULL;
 }
+
+int
+gioIsNotingInputPackets (GioEndpoint *endpoint) {
+  return !!endpoint->methods->noteInputPacket;
+}
+
+void
+gioNoteInputPacket (GioEndpoint *endpoint, size_t size, unsigned long int nanoseconds) {
+  GioNoteInputPacketMethod *method = endpoint->methods->noteInputPacket;
+
+  if (method) method(endpoint->handle, size, nanoseconds);
+}
@@ -61,7 +61,7 @@ typedef ssize_t GioAskResourceMethod (
 
 typedef int GioGetHidReportItemsMethod (GioHandle *handle, GioHidReportItemsData *items, int timeout);
 
-typedef size_t GioGetHidReportSizeMethod (const GioHidReportItemsData *items, unsigned char report);
+typedef size_t GioGetHidReportSizeMethod (GioHandle *handle, const GioHidReportItemsData *items, unsigned char report);
 
 typedef ssize_t GioSetHidReportMethod (
   GioHandle *handle, unsigned char report,
@@ -87,6 +87,8 @@ typedef int GioMonitorInputMethod (GioHandle *handle, AsyncMonitorCallback *call
 
 typedef void *GioGetResourceObjectMethod (GioHandle *handle);
 
+typedef void GioNoteInputPacketMethod (GioHandle *handle, size_t size, unsigned long int nanoseconds);
+
 typedef struct {
   GioDisconnectResourceMethod *disconnectResource;
 
@@ -114,6 +116,8 @@ typedef struct {
   GioMonitorInputMethod *monitorInput;
 
   GioGetResourceObjectMethod *getResourceObject;
+
+  GioNoteInputPacketMethod *noteInputPacket;
 } GioMethods;
 
 struct GioEndpointStruct {
@@ -165,6 +169,7 @@ extern const GioProperties gioProperties_null;
 extern const GioProperties gioProperties_serial;
 extern const GioProperties gioProperties_usb;
 extern const GioProperties gioProperties_bluetooth;
+extern const GioProperties gioProperties_replay;
 
 extern void gioSetBytesPerSecond (GioEndpoint *endpoint, const SerialParameters *parameters);
 
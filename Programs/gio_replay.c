@@ -0,0 +1,848 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
+
+#include "log.h"
+#include "strfmt.h"
+#include "parameters.h"
+#include "io_generic.h"
+#include "gio_internal.h"
+#include "parse.h"
+#include "device.h"
+#include "file.h"
+#include "timing.h"
+#include "async_wait.h"
+#include "async_alarm.h"
+#include "async_io.h"
+
+/* A replay resource runs a driver against a recorded session instead of a
+ * device. The session is a text file in which each line is one of:
+ *
+ *   > hex bytes   input for the driver to read
+ *   < hex bytes   output to wait for (input stops until it's written)
+ *   pause msecs   don't release any more input for a while
+ *   reply hex bytes = hex bytes
+ *                 whenever output starting with the first bytes is written
+ *                 (and isn't being waited for) answer it with the second
+ *
+ * Blank lines and lines starting with # are ignored. Replies are how
+ * acknowledgements and identity responses are scripted. Everything that the
+ * driver writes can also be captured (in the same format) to a file.
+ * The packet rate and the average parse time per packet are logged along
+ * with the other statistics when the driver disconnects.
+ */
+
+typedef enum {
+  REPLAY_INPUT,
+  REPLAY_OUTPUT,
+  REPLAY_PAUSE
+} ReplayStepType;
+
+typedef struct {
+  ReplayStepType type;
+  unsigned int milliseconds;
+  size_t size;
+  unsigned char *bytes;
+} ReplayStep;
+
+typedef struct {
+  size_t prefixSize;
+  unsigned char *prefix;
+  size_t responseSize;
+  unsigned char *response;
+} ReplayReply;
+
+typedef enum {
+  REPLAY_FILE,
+  REPLAY_RATE,
+  REPLAY_REPEAT,
+  REPLAY_CAPTURE
+} ReplayParameter;
+
+static const char *const replayParameters[] = {
+  "file",
+  "rate",
+  "repeat",
+  "capture",
+  NULL
+};
+
+struct GioHandleStruct {
+  char *path;
+  FILE *capture;
+  unsigned int rate;
+  unsigned int repeat;
+
+  struct {
+    ReplayStep *array;
+    unsigned int size;
+    unsigned int count;
+  } steps;
+
+  struct {
+    ReplayReply *array;
+    unsigned int size;
+    unsigned int count;
+  } replies;
+
+  struct {
+    unsigned char *buffer;
+    size_t size;
+    size_t from;
+    size_t to;
+  } answers;
+
+  struct {
+    unsigned int step;
+    size_t offset;
+    unsigned int pass;
+    TimeValue stepStarted;
+  } position;
+
+  struct {
+    TimeValue started;
+    size_t released;
+  } pacing;
+
+  struct {
+    AsyncHandle alarm;
+    AsyncMonitorCallback *callback;
+    void *data;
+  } monitor;
+
+  struct {
+    TimeValue started;
+    unsigned long int reads;
+    unsigned long int bytesRead;
+    unsigned long int writes;
+    unsigned long int bytesWritten;
+    unsigned long int matched;
+    unsigned long int mismatched;
+    unsigned long int answered;
+
+    unsigned long int packets;
+    unsigned long int parseNanoseconds;
+    TimeValue firstPacket;
+    TimeValue lastPacket;
+  } statistics;
+};
+
+static void
+logReplayStatistics (GioHandle *handle) {
+  long int elapsed = getMonotonicElapsed(&handle->statistics.started);
+  if (!elapsed) elapsed = 1;
+
+  logMessage(LOG_INFO,
+    "replay statistics: %s: Passes:%u Time:%ldms "
+    "Reads:%lu/%luB Writes:%lu/%luB Matched:%lu Mismatched:%lu Answered:%lu Rate:%luB/s",
+    handle->path, handle->position.pass, elapsed,
+    handle->statistics.reads, handle->statistics.bytesRead,
+    handle->statistics.writes, handle->statistics.bytesWritten,
+    handle->statistics.matched, handle->statistics.mismatched,
+    handle->statistics.answered,
+    (handle->statistics.bytesRead * MSECS_PER_SEC) / elapsed
+  );
+
+  if (handle->statistics.packets) {
+    long int span = millisecondsBetween(&handle->statistics.firstPacket,
+                                        &handle->statistics.lastPacket);
+    if (!span) span = 1;
+
+    logMessage(LOG_INFO,
+      "replay packets: %s: Packets:%lu Span:%ldms Rate:%lu/s Parse:%luns/packet",
+      handle->path, handle->statistics.packets, span,
+      (handle->statistics.packets * MSECS_PER_SEC) / span,
+      handle->statistics.parseNanoseconds / handle->statistics.packets
+    );
+  }
+}
+
+static void
+deallocateReplayReplies (GioHandle *handle) {
+  while (handle->replies.count > 0) {
+    ReplayReply *reply = &handle->replies.array[--handle->replies.count];
+    free(reply->prefix);
+    free(reply->response);
+  }
+
+  if (handle->replies.array) {
+    free(handle->replies.array);
+    handle->replies.array = NULL;
+  }
+
+  handle->replies.size = 0;
+
+  if (handle->answers.buffer) {
+    free(handle->answers.buffer);
+    handle->answers.buffer = NULL;
+  }
+}
+
+static void
+deallocateReplaySteps (GioHandle *handle) {
+  while (handle->steps.count > 0) {
+    ReplayStep *step = &handle->steps.array[--handle->steps.count];
+    if (step->bytes) free(step->bytes);
+  }
+
+  if (handle->steps.array) {
+    free(handle->steps.array);
+    handle->steps.array = NULL;
+  }
+
+  handle->steps.size = 0;
+}
+
+static void
+stopReplayMonitor (GioHandle *handle) {
+  if (handle->monitor.alarm) {
+    asyncCancelRequest(handle->monitor.alarm);
+    handle->monitor.alarm = NULL;
+  }
+}
+
+static int
+disconnectReplayResource (GioHandle *handle) {
+  stopReplayMonitor(handle);
+  logReplayStatistics(handle);
+
+  if (handle->capture) fclose(handle->capture);
+  deallocateReplaySteps(handle);
+  deallocateReplayReplies(handle);
+  free(handle->path);
+  free(handle);
+  return 1;
+}
+
+static const char *
+makeReplayResourceIdentifier (GioHandle *handle, char *buffer, size_t size) {
+  STR_BEGIN(buffer, size);
+  STR_PRINTF("%s%c%s", "replay", PARAMETER_QUALIFIER_CHARACTER, handle->path);
+  STR_END;
+  return buffer;
+}
+
+static void
+startReplayStep (GioHandle *handle) {
+  handle->position.offset = 0;
+  getMonotonicTime(&handle->position.stepStarted);
+}
+
+static void
+finishReplayStep (GioHandle *handle) {
+  if (++handle->position.step == handle->steps.count) {
+    if (++handle->position.pass < handle->repeat) {
+      handle->position.step = 0;
+    }
+  }
+
+  startReplayStep(handle);
+}
+
+static ReplayStep *
+getReplayStep (GioHandle *handle) {
+  while (handle->position.step < handle->steps.count) {
+    ReplayStep *step = &handle->steps.array[handle->position.step];
+
+    switch (step->type) {
+      case REPLAY_INPUT:
+        if (handle->position.offset < step->size) return step;
+        break;
+
+      case REPLAY_PAUSE:
+        if (getMonotonicElapsed(&handle->position.stepStarted) < step->milliseconds) return step;
+        break;
+
+      default:
+        return step;
+    }
+
+    finishReplayStep(handle);
+  }
+
+  return NULL;
+}
+
+static size_t
+getReplayInput (GioHandle *handle, const unsigned char **bytes) {
+  {
+    size_t count = handle->answers.to - handle->answers.from;
+
+    if (count) {
+      *bytes = &handle->answers.buffer[handle->answers.from];
+      return count;
+    }
+  }
+
+  const ReplayStep *step = getReplayStep(handle);
+  if (!step) return 0;
+  if (step->type != REPLAY_INPUT) return 0;
+
+  size_t count = step->size - handle->position.offset;
+
+  if (handle->rate) {
+    size_t allowed = (getMonotonicElapsed(&handle->pacing.started) * handle->rate) / MSECS_PER_SEC;
+
+    if (allowed <= handle->pacing.released) return 0;
+    allowed -= handle->pacing.released;
+    if (count > allowed) count = allowed;
+  }
+
+  *bytes = &step->bytes[handle->position.offset];
+  return count;
+}
+
+static int
+isReplayWaiting (GioHandle *handle) {
+  const ReplayStep *step = getReplayStep(handle);
+  if (!step) return 0;
+
+  /* nothing can change while the driver owes some output */
+  if (step->type == REPLAY_OUTPUT) return 0;
+
+  return 1;
+}
+
+static int
+awaitReplayInput (GioHandle *handle, int timeout) {
+  TimePeriod period;
+  startTimePeriod(&period, timeout);
+
+  while (1) {
+    const unsigned char *bytes;
+    if (getReplayInput(handle, &bytes)) return 1;
+
+    if (!isReplayWaiting(handle)) break;
+    if (afterTimePeriod(&period, NULL)) break;
+    asyncWait(GIO_REPLAY_POLL_INTERVAL);
+  }
+
+  errno = EAGAIN;
+  return 0;
+}
+
+static ssize_t
+readReplayData (
+  GioHandle *handle, void *buffer, size_t size,
+  int initialTimeout, int subsequentTimeout
+) {
+  unsigned char *target = buffer;
+  size_t length = 0;
+
+  while (length < size) {
+    if (!awaitReplayInput(handle, (length? subsequentTimeout: initialTimeout))) break;
+
+    const unsigned char *bytes;
+    size_t count = getReplayInput(handle, &bytes);
+
+    if (count > (size - length)) count = size - length;
+    memcpy(&target[length], bytes, count);
+    length += count;
+
+    if (handle->answers.to > handle->answers.from) {
+      handle->answers.from += count;
+    } else {
+      handle->position.offset += count;
+      handle->pacing.released += count;
+    }
+  }
+
+  if (length) {
+    handle->statistics.reads += 1;
+    handle->statistics.bytesRead += length;
+  }
+
+  return length;
+}
+
+static void
+captureReplayData (GioHandle *handle, const unsigned char *bytes, size_t size) {
+  if (handle->capture) {
+    FILE *stream = handle->capture;
+    fputc('<', stream);
+
+    for (size_t index=0; index<size; index+=1) {
+      fprintf(stream, " %02X", bytes[index]);
+    }
+
+    fputc('\n', stream);
+  }
+}
+
+static int
+addReplayAnswer (GioHandle *handle, const unsigned char *bytes, size_t count) {
+  if (handle->answers.from == handle->answers.to) {
+    handle->answers.from = handle->answers.to = 0;
+  }
+
+  {
+    size_t size = handle->answers.to + count;
+
+    if (size > handle->answers.size) {
+      unsigned char *buffer = realloc(handle->answers.buffer, size);
+
+      if (!buffer) {
+        logMallocError();
+        return 0;
+      }
+
+      handle->answers.buffer = buffer;
+      handle->answers.size = size;
+    }
+  }
+
+  memcpy(&handle->answers.buffer[handle->answers.to], bytes, count);
+  handle->answers.to += count;
+  return 1;
+}
+
+static void
+answerReplayOutput (GioHandle *handle, const unsigned char *bytes, size_t size) {
+  const ReplayReply *reply = handle->replies.array;
+  const ReplayReply *end = reply + handle->replies.count;
+
+  while (reply < end) {
+    if (size >= reply->prefixSize) {
+      if (memcmp(bytes, reply->prefix, reply->prefixSize) == 0) {
+        if (addReplayAnswer(handle, reply->response, reply->responseSize)) {
+          handle->statistics.answered += 1;
+        }
+
+        return;
+      }
+    }
+
+    reply += 1;
+  }
+}
+
+static ssize_t
+writeReplayData (GioHandle *handle, const void *data, size_t size, int timeout) {
+  const unsigned char *bytes = data;
+  const unsigned char *end = bytes + size;
+
+  handle->statistics.writes += 1;
+  handle->statistics.bytesWritten += size;
+  if (!size) return 0;
+  captureReplayData(handle, bytes, size);
+
+  {
+    const ReplayStep *step = getReplayStep(handle);
+
+    if (!step || (step->type != REPLAY_OUTPUT) || (step->bytes[handle->position.offset] != *bytes)) {
+      answerReplayOutput(handle, bytes, size);
+      return size;
+    }
+  }
+
+  while (bytes < end) {
+    const ReplayStep *step = getReplayStep(handle);
+    if (!step) break;
+    if (step->type != REPLAY_OUTPUT) break;
+
+    size_t count = step->size - handle->position.offset;
+    if (count > (end - bytes)) count = end - bytes;
+
+    if (memcmp(bytes, &step->bytes[handle->position.offset], count) != 0) {
+      logBytes(LOG_WARNING, "unexpected replay output", data, size);
+      handle->statistics.mismatched += 1;
+      handle->position.offset = 0;
+      break;
+    }
+
+    bytes += count;
+    handle->position.offset += count;
+
+    if (handle->position.offset == step->size) {
+      handle->statistics.matched += 1;
+      finishReplayStep(handle);
+    }
+  }
+
+  return size;
+}
+
+ASYNC_ALARM_CALLBACK(handleReplayMonitorAlarm) {
+  GioHandle *handle = parameters->data;
+  const unsigned char *bytes;
+
+  if (getReplayInput(handle, &bytes)) {
+    const AsyncMonitorCallbackParameters mcp = {
+      .data = handle->monitor.data,
+      .error = 0
+    };
+
+    handle->monitor.callback(&mcp);
+  }
+}
+
+/* There's no descriptor to monitor so poll the session at the replay
+ * interval rather than leave the driver to the (much slower) input poll.
+ */
+static int
+monitorReplayInput (GioHandle *handle, AsyncMonitorCallback *callback, void *data) {
+  stopReplayMonitor(handle);
+  if (!callback) return 1;
+
+  if (asyncNewRelativeAlarm(&handle->monitor.alarm, 0, handleReplayMonitorAlarm, handle)) {
+    if (asyncResetAlarmInterval(handle->monitor.alarm, GIO_REPLAY_POLL_INTERVAL)) {
+      handle->monitor.callback = callback;
+      handle->monitor.data = data;
+      return 1;
+    }
+
+    stopReplayMonitor(handle);
+  }
+
+  return 0;
+}
+
+static int
+reconfigureReplayResource (GioHandle *handle, const SerialParameters *parameters) {
+  return 1;
+}
+
+static void
+noteReplayInputPacket (GioHandle *handle, size_t size, unsigned long int nanoseconds) {
+  if (!handle->statistics.packets++) {
+    getMonotonicTime(&handle->statistics.firstPacket);
+    handle->statistics.lastPacket = handle->statistics.firstPacket;
+  } else {
+    getMonotonicTime(&handle->statistics.lastPacket);
+  }
+
+  handle->statistics.parseNanoseconds += nanoseconds;
+}
+
+static const GioMethods gioReplayMethods = {
+  .disconnectResource = disconnectReplayResource,
+
+  .makeResourceIdentifier = makeReplayResourceIdentifier,
+
+  .writeData = writeReplayData,
+  .awaitInput = awaitReplayInput,
+  .readData = readReplayData,
+  .monitorInput = monitorReplayInput,
+
+  .reconfigureResource = reconfigureReplayResource,
+
+  .noteInputPacket = noteReplayInputPacket
+};
+
+static int
+testReplayIdentifier (const char **identifier) {
+  return hasQualifier(identifier, "replay");
+}
+
+static const GioPublicProperties gioPublicProperties_replay = {
+  .testIdentifier = testReplayIdentifier,
+
+  .type = {
+    .name = "replay",
+    .identifier = GIO_TYPE_REPLAY
+  }
+};
+
+static int
+isReplaySupported (const GioDescriptor *descriptor) {
+  return 1;
+}
+
+static const GioOptions *
+getReplayOptions (const GioDescriptor *descriptor) {
+  if (descriptor->serial.parameters) return &descriptor->serial.options;
+  if (descriptor->usb.channelDefinitions) return &descriptor->usb.options;
+  return &descriptor->null.options;
+}
+
+static const GioMethods *
+getReplayMethods (void) {
+  return &gioReplayMethods;
+}
+
+static ReplayStep *
+addReplayStep (GioHandle *handle, ReplayStepType type) {
+  if (handle->steps.count == handle->steps.size) {
+    unsigned int newSize = handle->steps.size? handle->steps.size<<1: 0X40;
+    ReplayStep *newArray = realloc(handle->steps.array, ARRAY_SIZE(newArray, newSize));
+
+    if (!newArray) {
+      logMallocError();
+      return NULL;
+    }
+
+    handle->steps.array = newArray;
+    handle->steps.size = newSize;
+  }
+
+  ReplayStep *step = &handle->steps.array[handle->steps.count++];
+  memset(step, 0, sizeof(*step));
+  step->type = type;
+  return step;
+}
+
+static int
+parseReplayBytes (unsigned char **bytes, size_t *size, const char *text, size_t length) {
+  unsigned char buffer[length];
+  size_t count = 0;
+  const char *end = text + length;
+
+  while (1) {
+    while ((text < end) && isspace((unsigned char)*text)) text += 1;
+    if (text == end) break;
+
+    char *next;
+    unsigned long int value = strtoul(text, &next, 0X10);
+
+    if ((next == text) || (next > end) || (value > UINT8_MAX)) return 0;
+    if ((next < end) && !isspace((unsigned char)*next)) return 0;
+
+    buffer[count++] = value;
+    text = next;
+  }
+
+  if (!count) return 0;
+
+  if (!(*bytes = malloc(count))) {
+    logMallocError();
+    return 0;
+  }
+
+  memcpy(*bytes, buffer, count);
+  *size = count;
+  return 1;
+}
+
+static int
+parseReplayReply (GioHandle *handle, const char *text) {
+  const char *delimiter = strchr(text, '=');
+  if (!delimiter) return 0;
+
+  ReplayReply reply;
+
+  if (parseReplayBytes(&reply.prefix, &reply.prefixSize, text, delimiter-text)) {
+    delimiter += 1;
+
+    if (parseReplayBytes(&reply.response, &reply.responseSize, delimiter, strlen(delimiter))) {
+      if (handle->replies.count == handle->replies.size) {
+        unsigned int newSize = handle->replies.size? handle->replies.size<<1: 0X8;
+        ReplayReply *newArray = realloc(handle->replies.array, ARRAY_SIZE(newArray, newSize));
+
+        if (newArray) {
+          handle->replies.array = newArray;
+          handle->replies.size = newSize;
+        } else {
+          logMallocError();
+        }
+      }
+
+      if (handle->replies.count < handle->replies.size) {
+        handle->replies.array[handle->replies.count++] = reply;
+        return 1;
+      }
+
+      free(reply.response);
+    }
+
+    free(reply.prefix);
+  }
+
+  return 0;
+}
+
+static const char *
+testReplayKeyword (const char *line, const char *keyword) {
+  size_t length = strlen(keyword);
+
+  if (strncmp(line, keyword, length) != 0) return NULL;
+  if (!isspace((unsigned char)line[length])) return NULL;
+  return &line[length];
+}
+
+static int
+parseReplayLine (const LineHandlerParameters *parameters) {
+  GioHandle *handle = parameters->data;
+  const char *line = parameters->line.text;
+  const char *operand;
+
+  while (isspace((unsigned char)*line)) line += 1;
+  if (!*line) return 1;
+  if (*line == '#') return 1;
+
+  if ((*line == '>') || (*line == '<')) {
+    ReplayStep *step = addReplayStep(handle, ((*line == '>')? REPLAY_INPUT: REPLAY_OUTPUT));
+    if (!step) return 0;
+
+    operand = line + 1;
+    if (parseReplayBytes(&step->bytes, &step->size, operand, strlen(operand))) return 1;
+    handle->steps.count -= 1;
+  } else if ((operand = testReplayKeyword(line, "pause"))) {
+    int milliseconds;
+
+    while (isspace((unsigned char)*operand)) operand += 1;
+
+    if (isInteger(&milliseconds, operand) && (milliseconds >= 0)) {
+      ReplayStep *step = addReplayStep(handle, REPLAY_PAUSE);
+      if (!step) return 0;
+
+      step->milliseconds = milliseconds;
+      return 1;
+    }
+  } else if ((operand = testReplayKeyword(line, "reply"))) {
+    if (parseReplayReply(handle, operand)) return 1;
+  }
+
+  logMessage(LOG_WARNING, "invalid replay line: %s[%u]: %s",
+             handle->path, parameters->line.number, parameters->line.text);
+  return 1;
+}
+
+static int
+loadReplaySession (GioHandle *handle) {
+  int ok = 0;
+  FILE *stream = openFile(handle->path, "r", 0);
+
+  if (stream) {
+    if (processLines(stream, parseReplayLine, handle)) ok = 1;
+    fclose(stream);
+
+    if (ok) {
+      logMessage(LOG_DEBUG, "replay session loaded: %s: %u steps",
+                 handle->path, handle->steps.count);
+    }
+  }
+
+  return ok;
+}
+
+static int
+processReplayParameters (GioHandle *handle, char **parameters) {
+  {
+    const char *file = parameters[REPLAY_FILE];
+
+    if (!(file && *file)) {
+      logMessage(LOG_ERR, "replay file not specified");
+      return 0;
+    }
+
+    if (!(handle->path = strdup(file))) {
+      logMallocError();
+      return 0;
+    }
+  }
+
+  {
+    static const int minimum = 0;
+    int rate = 0;
+    const char *parameter = parameters[REPLAY_RATE];
+
+    if (parameter && *parameter) {
+      if (!validateInteger(&rate, parameter, &minimum, NULL)) {
+        logMessage(LOG_ERR, "invalid replay rate: %s", parameter);
+        return 0;
+      }
+    }
+
+    handle->rate = rate;
+  }
+
+  {
+    static const int minimum = 1;
+    int repeat = 1;
+    const char *parameter = parameters[REPLAY_REPEAT];
+
+    if (parameter && *parameter) {
+      if (!validateInteger(&repeat, parameter, &minimum, NULL)) {
+        logMessage(LOG_ERR, "invalid replay repeat count: %s", parameter);
+        return 0;
+      }
+    }
+
+    handle->repeat = repeat;
+  }
+
+  {
+    const char *capture = parameters[REPLAY_CAPTURE];
+
+    if (capture && *capture) {
+      if (!(handle->capture = openFile(capture, "w", 0))) return 0;
+    }
+  }
+
+  return 1;
+}
+
+static GioHandle *
+connectReplayResource (
+  const char *identifier,
+  const GioDescriptor *descriptor
+) {
+  GioHandle *handle = malloc(sizeof(*handle));
+
+  if (handle) {
+    memset(handle, 0, sizeof(*handle));
+    handle->path = NULL;
+    handle->capture = NULL;
+    handle->steps.array = NULL;
+
+    char **parameters = getDeviceParameters(replayParameters, identifier);
+
+    if (parameters) {
+      int ok = processReplayParameters(handle, parameters) && loadReplaySession(handle);
+      deallocateStrings(parameters);
+
+      if (ok) {
+        getMonotonicTime(&handle->statistics.started);
+        handle->pacing.started = handle->statistics.started;
+        startReplayStep(handle);
+        return handle;
+      }
+    }
+
+    if (handle->capture) fclose(handle->capture);
+    deallocateReplaySteps(handle);
+    deallocateReplayReplies(handle);
+    if (handle->path) free(handle->path);
+    free(handle);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+static const GioPrivateProperties gioPrivateProperties_replay = {
+  .isSupported = isReplaySupported,
+
+  .getOptions = getReplayOptions,
+  .getMethods = getReplayMethods,
+
+  .connectResource = connectReplayResource
+};
+
+const GioProperties gioProperties_replay = {
+  .public = &gioPublicProperties_replay,
+  .private = &gioPrivateProperties_replay
+};
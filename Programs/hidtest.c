@@ -0,0 +1,269 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <glob.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "io_usb.h"
+#include "usb_internal.h"
+
+BEGIN_OPTION_TABLE(programOptions)
+END_OPTION_TABLE
+
+typedef struct {
+  const char *name;
+  const unsigned char *items;
+  size_t size;
+} TestDescriptor;
+
+/* HID 1.11, appendix B.1: the boot protocol keyboard (no report identifiers) */
+static const unsigned char keyboardDescriptor[] = {
+  0X05, 0X01, 0X09, 0X06, 0XA1, 0X01, 0X05, 0X07,
+  0X19, 0XE0, 0X29, 0XE7, 0X15, 0X00, 0X25, 0X01,
+  0X75, 0X01, 0X95, 0X08, 0X81, 0X02, 0X95, 0X01,
+  0X75, 0X08, 0X81, 0X01, 0X95, 0X05, 0X75, 0X01,
+  0X05, 0X08, 0X19, 0X01, 0X29, 0X05, 0X91, 0X02,
+  0X95, 0X01, 0X75, 0X03, 0X91, 0X01, 0X95, 0X06,
+  0X75, 0X08, 0X15, 0X00, 0X25, 0X65, 0X05, 0X07,
+  0X19, 0X00, 0X29, 0X65, 0X81, 0X00, 0XC0
+};
+
+/* a keyboard and a consumer control in one device, each with its own report */
+static const unsigned char compositeDescriptor[] = {
+  0X05, 0X01, 0X09, 0X06, 0XA1, 0X01, 0X85, 0X01,
+  0X75, 0X01, 0X95, 0X08, 0X05, 0X07, 0X19, 0XE0,
+  0X29, 0XE7, 0X15, 0X00, 0X25, 0X01, 0X81, 0X02,
+  0X95, 0X06, 0X75, 0X08, 0X15, 0X00, 0X26, 0XFF,
+  0X00, 0X05, 0X07, 0X19, 0X00, 0X2A, 0XFF, 0X00,
+  0X81, 0X00, 0XC0, 0X05, 0X0C, 0X09, 0X01, 0XA1,
+  0X01, 0X85, 0X02, 0X15, 0X00, 0X26, 0X3C, 0X02,
+  0X19, 0X00, 0X2A, 0X3C, 0X02, 0X75, 0X10, 0X95,
+  0X01, 0X81, 0X00, 0XC0
+};
+
+/* laid out like a HandyTech USB-HID adapter: vendor defined reports for data
+ * in each direction and for the adapter's own commands
+ */
+static const unsigned char adapterDescriptor[] = {
+  0X06, 0X00, 0XFF, 0X09, 0X01, 0XA1, 0X01, 0X85,
+  0X01, 0X15, 0X00, 0X26, 0XFF, 0X00, 0X75, 0X08,
+  0X95, 0X3F, 0X09, 0X01, 0X81, 0X02, 0X85, 0X02,
+  0X15, 0X00, 0X26, 0XFF, 0X00, 0X75, 0X08, 0X95,
+  0X3F, 0X09, 0X01, 0X91, 0X02, 0X85, 0XFB, 0X75,
+  0X08, 0X95, 0X01, 0X09, 0X01, 0XB1, 0X02, 0X85,
+  0XFC, 0X75, 0X08, 0X95, 0X05, 0X09, 0X01, 0XB1,
+  0X02, 0X85, 0XFD, 0X75, 0X20, 0X95, 0X01, 0X09,
+  0X01, 0XB1, 0X02, 0X85, 0XFE, 0X75, 0X20, 0X95,
+  0X01, 0X09, 0X01, 0XB1, 0X02, 0XC0
+};
+
+static const TestDescriptor builtinDescriptors[] = {
+  {.name="boot keyboard", .items=keyboardDescriptor, .size=sizeof(keyboardDescriptor)},
+  {.name="composite", .items=compositeDescriptor, .size=sizeof(compositeDescriptor)},
+  {.name="adapter", .items=adapterDescriptor, .size=sizeof(adapterDescriptor)},
+};
+
+static int
+compareDescriptions (
+  const UsbHidReportDescription *parsed,
+  const UsbHidReportDescription *cached
+) {
+  if (!parsed || !cached) return !parsed && !cached;
+  if (parsed->reportIdentifier != cached->reportIdentifier) return 0;
+  if (parsed->defined != cached->defined) return 0;
+
+  if (parsed->defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportCount)) {
+    if (parsed->reportCount != cached->reportCount) return 0;
+  }
+
+  if (parsed->defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportSize)) {
+    if (parsed->reportSize != cached->reportSize) return 0;
+  }
+
+  if (parsed->defined & USB_HID_ITEM_BIT(UsbHidItemType_LogicalMinimum)) {
+    if (parsed->logicalMinimum != cached->logicalMinimum) return 0;
+  }
+
+  if (parsed->defined & USB_HID_ITEM_BIT(UsbHidItemType_LogicalMaximum)) {
+    if (parsed->logicalMaximum != cached->logicalMaximum) return 0;
+  }
+
+  return 1;
+}
+
+/* Every report identifier must be described, and sized, by the per-device
+ * table exactly as the descriptor parser describes and sizes it.
+ */
+static int
+compareReports (UsbDevice *device, const unsigned char *items, size_t size, unsigned int *reports) {
+  UsbHidReportTable *table = usbHidNewReportTable(items, size);
+  if (!table) return 0;
+  int ok = 1;
+
+  for (unsigned int identifier=0; identifier<=0XFF; identifier+=1) {
+    UsbHidReportDescription description;
+    int found = usbHidFillReportDescription(items, size, identifier, &description);
+
+    if (!compareDescriptions((found? &description: NULL),
+                             usbHidGetReportDescription(table, identifier))) {
+      logMessage(LOG_ERR, "report %02X described differently", identifier);
+      ok = 0;
+      break;
+    }
+
+    size_t parsedSize;
+    size_t cachedSize;
+    int parsed = usbHidGetReportSize(items, size, identifier, &parsedSize);
+    int cached = usbHidGetCachedReportSize(device, items, size, identifier, &cachedSize);
+
+    if ((parsed != cached) || (parsedSize != cachedSize)) {
+      logMessage(LOG_ERR, "report %02X sized differently: parsed:%d/%zu cached:%d/%zu",
+                 identifier, parsed, parsedSize, cached, cachedSize);
+      ok = 0;
+      break;
+    }
+
+    if (parsed) *reports += 1;
+  }
+
+  usbHidDestroyReportTable(table);
+  return ok;
+}
+
+static int
+testDescriptor (UsbDevice *device, const TestDescriptor *descriptor) {
+  unsigned int reports = 0;
+
+  if (!compareReports(device, descriptor->items, descriptor->size, &reports)) {
+    logMessage(LOG_ERR, "descriptor not equivalent: %s", descriptor->name);
+    return 0;
+  }
+
+  /* a descriptor cut off anywhere must be handled the same way too */
+  for (size_t size=0; size<descriptor->size; size+=1) {
+    unsigned int truncated = 0;
+
+    if (!compareReports(device, descriptor->items, size, &truncated)) {
+      logMessage(LOG_ERR, "truncated descriptor not equivalent: %s: %zu bytes",
+                 descriptor->name, size);
+      return 0;
+    }
+  }
+
+  printf("%s: %zu bytes, %u sized reports\n", descriptor->name, descriptor->size, reports);
+  return 1;
+}
+
+static int
+testFile (UsbDevice *device, const char *path) {
+  FILE *stream = fopen(path, "rb");
+
+  if (!stream) {
+    logMessage(LOG_ERR, "cannot open descriptor file: %s: %s", path, strerror(errno));
+    return 0;
+  }
+
+  unsigned char items[0X1000];
+  size_t size = fread(items, 1, sizeof(items), stream);
+  int ok = !ferror(stream);
+  fclose(stream);
+
+  if (!ok) {
+    logMessage(LOG_ERR, "cannot read descriptor file: %s", path);
+    return 0;
+  }
+
+  const TestDescriptor descriptor = {
+    .name = path,
+    .items = items,
+    .size = size
+  };
+
+  return testDescriptor(device, &descriptor);
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "hidtest",
+      .argumentsSummary = "[descriptor-file ...]"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  /* every identifier is probed, and most of them aren't defined */
+  stderrLogLevel = LOG_ERR;
+
+  /* only the report table of the device is used */
+  static UsbDevice device;
+
+  for (unsigned int index=0; index<ARRAY_COUNT(builtinDescriptors); index+=1) {
+    if (!testDescriptor(&device, &builtinDescriptors[index])) return PROG_EXIT_FATAL;
+  }
+
+  {
+    const unsigned char *items = builtinDescriptors[1].items;
+    size_t size = builtinDescriptors[1].size;
+    size_t reportSize;
+
+    /* the table cached for one descriptor mustn't answer for another */
+    if (!usbHidGetCachedReportSize(&device, adapterDescriptor, sizeof(adapterDescriptor), 0XFC, &reportSize) ||
+        usbHidGetCachedReportSize(&device, items, size, 0XFC, &reportSize)) {
+      logMessage(LOG_ERR, "cached report table not replaced for a new descriptor");
+      return PROG_EXIT_FATAL;
+    }
+  }
+
+  if (argc) {
+    while (argc) {
+      if (!testFile(&device, *argv)) return PROG_EXIT_FATAL;
+      argv += 1, argc -= 1;
+    }
+  } else {
+    /* descriptors recorded by the kernel for the devices which are attached */
+    glob_t paths;
+
+    if (glob("/sys/class/hidraw/*/device/report_descriptor", 0, NULL, &paths) == 0) {
+      for (size_t index=0; index<paths.gl_pathc; index+=1) {
+        if (!testFile(&device, paths.gl_pathv[index])) {
+          globfree(&paths);
+          return PROG_EXIT_FATAL;
+        }
+      }
+
+      globfree(&paths);
+    }
+  }
+
+  usbHidForgetReportTable(&device);
+  return PROG_EXIT_SUCCESS;
+}
+
+#include "brl.h"
+
+const BrailleDriver *braille = NULL;
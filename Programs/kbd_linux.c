@@ -36,9 +36,7 @@
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
-#include <sys/socket.h>
 #include <linux/types.h>
-#include <linux/netlink.h>
 #include <linux/input.h>
 #include <linux/uinput.h>
 
@@ -46,10 +44,11 @@
 #include "async_alarm.h"
 #include "async_io.h"
 
+#include "uevent.h"
+
 struct KeyboardMonitorExtensionStruct {
   struct {
-    int socket;
-    AsyncHandle monitor;
+    UeventListenerInstance *listener;
   } uevent;
 };
 
@@ -444,8 +443,7 @@ newKeyboardMonitorExtension (KeyboardMonitorExtension **kmx) {
   if ((*kmx = malloc(sizeof(**kmx)))) {
     memset(*kmx,  0, sizeof(**kmx));
 
-    (*kmx)->uevent.socket = -1;
-    (*kmx)->uevent.monitor = NULL;
+    (*kmx)->uevent.listener = NULL;
 
     return 1;
   } else {
@@ -457,8 +455,7 @@ newKeyboardMonitorExtension (KeyboardMonitorExtension **kmx) {
 
 void
 destroyKeyboardMonitorExtension (KeyboardMonitorExtension *kmx) {
-  if (kmx->uevent.monitor) asyncCancelRequest(kmx->uevent.monitor);
-  if (kmx->uevent.socket != -1) close(kmx->uevent.socket);
+  if (kmx->uevent.listener) unregisterUeventListener(kmx->uevent.listener);
   free(kmx);
 }
 
@@ -796,7 +793,6 @@ monitorCurrentKeyboards (KeyboardMonitorObject *kmo) {
   logMessage(LOG_DEBUG, "keyboard search complete");
 }
 
-#ifdef NETLINK_KOBJECT_UEVENT
 ASYNC_ALARM_CALLBACK(openLinuxInputDevice) {
   KeyboardInstanceObject *kio = parameters->data;
 
@@ -835,138 +831,48 @@ getDeviceNumbers (const char *device, int *major, int *minor) {
   return ok;
 }
 
-ASYNC_INPUT_CALLBACK(handleKobjectUeventString) {
-  KeyboardMonitorObject *kmo = parameters->data;
-  static const char label[] = "kobject uevent";
-
-  if (parameters->error) {
-    logMessage(LOG_DEBUG, "%s read error: %s", label, strerror(parameters->error));
-  } else if (parameters->end) {
-    logMessage(LOG_DEBUG, "%s end-of-file", label);
-  } else {
-    const char *string = parameters->buffer;
-    const char *end = memchr(string, 0, parameters->length);
-
-    if (end) {
-      size_t length = end - string;
-
-      static const char delimiters[] = {'@', '=', '\0'};
-      const char *delimiter = strpbrk(string, delimiters);
-
-      if (!delimiter) {
-        const char *data = end + 1;
-        size_t size;
+UEVENT_LISTENER(handleInputUevent) {
+  KeyboardMonitorObject *kmo = parameters->listenerData;
+  const char *device = parameters->device;
 
-        if (strcmp(string, "libudev") == 0) {
-          size = 32;
-        } else {
-          logMessage(LOG_WARNING, "unrecognized %s segment: %s", label, string);
-          size = 0;
-        }
-
-        length += size;
-        if (parameters->length < length) return 0;
-        logBytes(LOG_DEBUG, "%s data: %s", data, size, label, string);
-      } else if (*delimiter == '@') {
-        const char *action = string;
-        const char *device = delimiter + 1;
-        int actionLength = delimiter - action;
-
-        logMessage(LOG_DEBUG, "%s action: %.*s %s", label, actionLength, action, device);
-
-        if (strncmp(action, "add", actionLength) == 0) {
-          const char *suffix = device;
+  if (strcmp(parameters->action, "add") == 0) {
+    const char *suffix = device;
 
-          while ((suffix = strstr(suffix, "/input"))) {
-            int input;
-            int event;
+    while ((suffix = strstr(suffix, "/input"))) {
+      int input;
+      int event;
 
-            if (sscanf(++suffix, "input%d/event%d", &input, &event) == 2) {
-              KeyboardInstanceObject *kio;
+      if (sscanf(++suffix, "input%d/event%d", &input, &event) == 2) {
+        KeyboardInstanceObject *kio;
 
-              if ((kio = newKeyboardInstanceObject(kmo))) {
-                if (getDeviceNumbers(device, &kio->kix->device.major, &kio->kix->device.minor)) {
-                  char path[0X40];
+        if ((kio = newKeyboardInstanceObject(kmo))) {
+          if (getDeviceNumbers(device, &kio->kix->device.major, &kio->kix->device.minor)) {
+            char path[0X40];
 
-                  snprintf(path, sizeof(path), "/dev/input/event%d", event);
+            snprintf(path, sizeof(path), "/dev/input/event%d", event);
 
-                  if ((kio->kix->device.path = strdup(path))) {
-                    if (asyncNewRelativeAlarm(&kio->kix->udevDelay,
-                                              LINUX_INPUT_DEVICE_OPEN_DELAY,
-                                              openLinuxInputDevice, kio)) {
-                      break;
-                    }
-                  } else {
-                    logMallocError();
-                  }
-                }
-
-                destroyKeyboardInstanceObject(kio);
+            if ((kio->kix->device.path = strdup(path))) {
+              if (asyncNewRelativeAlarm(&kio->kix->udevDelay,
+                                        LINUX_INPUT_DEVICE_OPEN_DELAY,
+                                        openLinuxInputDevice, kio)) {
+                break;
               }
+            } else {
+              logMallocError();
             }
           }
-        }
-      } else if (*delimiter == '=') {
-        const char *name = string;
-        const char *value = delimiter + 1;
-        int nameLength = delimiter - name;
 
-        logMessage(LOG_DEBUG, "%s property: %.*s %s", label, nameLength, name, value);
+          destroyKeyboardInstanceObject(kio);
+        }
       }
-
-      return length + 1;
     }
   }
-
-  return 0;
 }
 
-static int
-getKobjectUeventSocket (void) {
-  static int socketDescriptor = -1;
-
-  if (socketDescriptor == -1) {
-    const struct sockaddr_nl socketAddress = {
-      .nl_family = AF_NETLINK,
-      .nl_pid = getpid(),
-      .nl_groups = 0XFFFFFFFF
-    };
-
-    if ((socketDescriptor = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_KOBJECT_UEVENT)) != -1) {
-      if (bind(socketDescriptor, (const struct sockaddr *)&socketAddress, sizeof(socketAddress)) != -1) {
-        logMessage(LOG_DEBUG,
-          "netlink kobject uevent socket opened: fd=%d", socketDescriptor
-        );
-      } else {
-        logSystemError("netlink kobject uevent socket bind");
-        close(socketDescriptor);
-        socketDescriptor = -1;
-      }
-    } else {
-      logSystemError("netlink kobject uevent socket creation");
-    }
-  }
-
-  return socketDescriptor;
-}
-#endif /* NETLINK_KOBJECT_UEVENT */
 
 static int
 monitorNewKeyboards (KeyboardMonitorObject *kmo) {
-#ifdef NETLINK_KOBJECT_UEVENT
-  if ((kmo->kmx->uevent.socket = getKobjectUeventSocket()) != -1) {
-    if (asyncReadSocket(&kmo->kmx->uevent.monitor,
-                        kmo->kmx->uevent.socket, 6+1+PATH_MAX+1,
-                        handleKobjectUeventString, kmo)) {
-      return 1;
-    }
-
-    close(kmo->kmx->uevent.socket);
-    kmo->kmx->uevent.socket = -1;
-  }
-#endif /* NETLINK_KOBJECT_UEVENT */
-
-  return 0;
+  return !!(kmo->kmx->uevent.listener = registerUeventListener("input", handleInputUevent, kmo));
 }
 #endif /* HAVE_LINUX_UINPUT_H */
 
@@ -186,14 +186,20 @@ getKeyContext (KeyTableData *ktd, unsigned char context) {
       ctx->keyBindings.table = NULL;
       ctx->keyBindings.size = 0;
       ctx->keyBindings.count = 0;
+      ctx->keyBindings.index.slots = NULL;
+      ctx->keyBindings.index.mask = 0;
 
       ctx->hotkeys.table = NULL;
       ctx->hotkeys.size = 0;
       ctx->hotkeys.count = 0;
+      ctx->hotkeys.index.slots = NULL;
+      ctx->hotkeys.index.mask = 0;
 
       ctx->mappedKeys.table = NULL;
       ctx->mappedKeys.size = 0;
       ctx->mappedKeys.count = 0;
+      ctx->mappedKeys.index.slots = NULL;
+      ctx->mappedKeys.index.mask = 0;
       ctx->mappedKeys.superimpose = 0;
     }
   }
@@ -1558,11 +1564,96 @@ prepareKeyBindings (KeyContext *ctx) {
   return 1;
 }
 
+typedef unsigned int KeyLookupHasher (const void *entry);
+
+static int
+makeKeyLookupIndex (
+  KeyLookupIndex *index, KeyLookupHasher *hashEntry,
+  const void *entries, size_t entrySize, unsigned int count
+) {
+  if (index->slots) {
+    free(index->slots);
+    index->slots = NULL;
+    index->mask = 0;
+  }
+
+  if (!count) return 1;
+
+  /* keep the load factor at or below one half so that probe sequences stay short */
+  unsigned int size = 0X8;
+  while (size < (count << 1)) size <<= 1;
+
+  if (!(index->slots = calloc(size, sizeof(*index->slots)))) {
+    logMallocError();
+    return 0;
+  }
+
+  index->mask = size - 1;
+  const unsigned char *entry = entries;
+
+  for (unsigned int position=0; position<count; position+=1) {
+    unsigned int slot = hashEntry(entry) & index->mask;
+
+    while (index->slots[slot]) slot = (slot + 1) & index->mask;
+    index->slots[slot] = position + 1;
+    entry += entrySize;
+  }
+
+  return 1;
+}
+
+static void
+destroyKeyLookupIndex (KeyLookupIndex *index) {
+  if (index->slots) free(index->slots);
+}
+
+static unsigned int
+hashKeyBinding (const void *entry) {
+  const KeyBinding *binding = entry;
+  return hashKeyCombination(&binding->keyCombination);
+}
+
+static unsigned int
+hashHotkeyEntry (const void *entry) {
+  const HotkeyEntry *hotkey = entry;
+  return hashKeyValue(KEY_LOOKUP_HASH_BASIS, &hotkey->keyValue);
+}
+
+static unsigned int
+hashMappedKeyEntry (const void *entry) {
+  const MappedKeyEntry *map = entry;
+  return hashKeyValue(KEY_LOOKUP_HASH_BASIS, &map->keyValue);
+}
+
+static int
+makeKeyContextIndexes (KeyContext *ctx) {
+  if (!makeKeyLookupIndex(&ctx->keyBindings.index, hashKeyBinding,
+                          ctx->keyBindings.table, sizeof(*ctx->keyBindings.table),
+                          ctx->keyBindings.count)) {
+    return 0;
+  }
+
+  if (!makeKeyLookupIndex(&ctx->hotkeys.index, hashHotkeyEntry,
+                          ctx->hotkeys.table, sizeof(*ctx->hotkeys.table),
+                          ctx->hotkeys.count)) {
+    return 0;
+  }
+
+  if (!makeKeyLookupIndex(&ctx->mappedKeys.index, hashMappedKeyEntry,
+                          ctx->mappedKeys.table, sizeof(*ctx->mappedKeys.table),
+                          ctx->mappedKeys.count)) {
+    return 0;
+  }
+
+  return 1;
+}
+
 int
 finishKeyTable (KeyTableData *ktd) {
   for (unsigned int context=0; context<ktd->table->keyContexts.count; context+=1) {
     KeyContext *ctx = &ktd->table->keyContexts.table[context];
     if (!prepareKeyBindings(ctx)) return 0;
+    if (!makeKeyContextIndexes(ctx)) return 0;
   }
 
   qsort(ktd->table->keyNames.table, ktd->table->keyNames.count, sizeof(*ktd->table->keyNames.table), sortKeyValues);
@@ -1708,6 +1799,10 @@ destroyKeyTable (KeyTable *table) {
     if (ctx->keyBindings.table) free(ctx->keyBindings.table);
     if (ctx->hotkeys.table) free(ctx->hotkeys.table);
     if (ctx->mappedKeys.table) free(ctx->mappedKeys.table);
+
+    destroyKeyLookupIndex(&ctx->keyBindings.index);
+    destroyKeyLookupIndex(&ctx->hotkeys.index);
+    destroyKeyLookupIndex(&ctx->mappedKeys.index);
   }
 
   if (table->keyContexts.table) free(table->keyContexts.table);
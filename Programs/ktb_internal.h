@@ -90,6 +90,11 @@ typedef struct {
   unsigned char flags;
 } MappedKeyEntry;
 
+typedef struct {
+  unsigned int *slots; /* entry index + 1, zero if the slot is empty */
+  unsigned int mask;
+} KeyLookupIndex;
+
 typedef struct {
   wchar_t *name;
   wchar_t *title;
@@ -102,18 +107,21 @@ typedef struct {
     KeyBinding *table;
     unsigned int size;
     unsigned int count;
+    KeyLookupIndex index;
   } keyBindings;
 
   struct {
     HotkeyEntry *table;
     unsigned int size;
     unsigned int count;
+    KeyLookupIndex index;
   } hotkeys;
 
   struct {
     MappedKeyEntry *table;
     unsigned int size;
     unsigned int count;
+    KeyLookupIndex index;
     int superimpose;
   } mappedKeys;
 } KeyContext;
@@ -191,6 +199,39 @@ extern int insertKeyValue (
 extern void removeKeyValue (KeyValue *values, unsigned int *count, unsigned int position);
 extern int deleteKeyValue (KeyValue *values, unsigned int *count, const KeyValue *value);
 
+#define KEY_LOOKUP_HASH_BASIS 0X811C9DC5
+#define KEY_LOOKUP_HASH_PRIME 0X01000193
+
+static inline unsigned int
+hashKeyByte (unsigned int hash, unsigned char byte) {
+  return (hash ^ byte) * KEY_LOOKUP_HASH_PRIME;
+}
+
+static inline unsigned int
+hashKeyValue (unsigned int hash, const KeyValue *value) {
+  hash = hashKeyByte(hash, value->group);
+  hash = hashKeyByte(hash, value->number);
+  return hash;
+}
+
+static inline unsigned int
+hashKeyCombination (const KeyCombination *combination) {
+  unsigned int hash = KEY_LOOKUP_HASH_BASIS;
+
+  if (combination->flags & KCF_IMMEDIATE_KEY) {
+    hash = hashKeyByte(hash, KCF_IMMEDIATE_KEY);
+    hash = hashKeyValue(hash, &combination->immediateKey);
+  }
+
+  hash = hashKeyByte(hash, combination->modifierCount);
+
+  for (unsigned int index=0; index<combination->modifierCount; index+=1) {
+    hash = hashKeyValue(hash, &combination->modifierKeys[index]);
+  }
+
+  return hash;
+}
+
 extern int compareKeyBindings (const KeyBinding *binding1, const KeyBinding *binding2);
 extern int compareHotkeyEntries (const HotkeyEntry *hotkey1, const HotkeyEntry *hotkey2);
 extern int compareMappedKeyEntries (const MappedKeyEntry *map1, const MappedKeyEntry *map2);
@@ -34,6 +34,7 @@
 #include "cmd.h"
 #include "cmd_enqueue.h"
 #include "async_alarm.h"
+#include "latency.h"
 
 #define BRL_CMD_ALERT(alert) BRL_CMD_ARG(ALERT, ALERT_##alert)
 
@@ -100,6 +101,25 @@ searchKeyBinding (const void *target, const void *element) {
   return compareKeyBindings(reference, binding);
 }
 
+static const void *
+searchKeyLookupIndex (
+  const KeyLookupIndex *index, unsigned int hash,
+  const void *entries, size_t entrySize,
+  const void *target, int (*compareEntries) (const void *target, const void *entry)
+) {
+  if (!index->slots) return NULL;
+  unsigned int slot = hash & index->mask;
+
+  while (1) {
+    unsigned int position = index->slots[slot];
+    if (!position) return NULL;
+
+    const void *entry = (const unsigned char *)entries + ((position - 1) * entrySize);
+    if (compareEntries(target, entry) == 0) return entry;
+    slot = (slot + 1) & index->mask;
+  }
+}
+
 static const KeyBinding *
 findKeyBinding (KeyTable *table, unsigned char context, const KeyValue *immediate, int *isIncomplete) {
   const KeyContext *ctx = getKeyContext(table, context);
@@ -139,10 +159,11 @@ findKeyBinding (KeyTable *table, unsigned char context, const KeyValue *immediat
       );
 
       {
-        const KeyBinding *binding = bsearch(&target, ctx->keyBindings.table,
-                                            ctx->keyBindings.count,
-                                            sizeof(*ctx->keyBindings.table),
-                                            searchKeyBinding);
+        const KeyBinding *binding = searchKeyLookupIndex(
+          &ctx->keyBindings.index, hashKeyCombination(&target.keyCombination),
+          ctx->keyBindings.table, sizeof(*ctx->keyBindings.table),
+          &target, searchKeyBinding
+        );
 
         if (binding) {
           if (binding->primaryCommand.value != EOF) return binding;
@@ -177,8 +198,11 @@ findHotkeyEntry (KeyTable *table, unsigned char context, const KeyValue *keyValu
     .keyValue = *keyValue
   };
 
-  return bsearch(&target, ctx->hotkeys.table, ctx->hotkeys.count,
-                 sizeof(*ctx->hotkeys.table), searchHotkeyEntry);
+  return searchKeyLookupIndex(
+    &ctx->hotkeys.index, hashKeyValue(KEY_LOOKUP_HASH_BASIS, keyValue),
+    ctx->hotkeys.table, sizeof(*ctx->hotkeys.table),
+    &target, searchHotkeyEntry
+  );
 }
 
 static int
@@ -197,8 +221,11 @@ findMappedKeyEntry (const KeyContext *ctx, const KeyValue *keyValue) {
     .keyValue = *keyValue
   };
 
-  return bsearch(&target, ctx->mappedKeys.table, ctx->mappedKeys.count,
-                 sizeof(*ctx->mappedKeys.table), searchMappedKeyEntry);
+  return searchKeyLookupIndex(
+    &ctx->mappedKeys.index, hashKeyValue(KEY_LOOKUP_HASH_BASIS, keyValue),
+    ctx->mappedKeys.table, sizeof(*ctx->mappedKeys.table),
+    &target, searchMappedKeyEntry
+  );
 }
 
 static int
@@ -312,9 +339,11 @@ isInputKey (BRL_Key key) {
 }
 
 static int
-processCommand (KeyTable *table, int command) {
+processCommand (KeyTable *table, int command, int repeat) {
   int isInput = 0;
 
+  traceLatency(getLatencyTrace(), LATENCY_STAGE_BINDING);
+
   switch (command) {
     default: {
       int arg = command & BRL_MSK_ARG;
@@ -379,7 +408,7 @@ processCommand (KeyTable *table, int command) {
     }
   }
 
-  return enqueueCommand(command);
+  return repeat? enqueueRepeatedCommand(command): enqueueCommand(command);
 }
 
 static void
@@ -428,7 +457,7 @@ ASYNC_ALARM_CALLBACK(handleLongPressAlarm) {
   }
 
   table->release.command = BRL_CMD_NOOP;
-  processCommand(table, command);
+  processCommand(table, command, table->longPress.repeat);
 }
 
 static void
@@ -522,7 +551,7 @@ processKeyEvent (
   if (hotkey) {
     const BoundCommand *cmd = press? &hotkey->pressCommand: &hotkey->releaseCommand;
 
-    if (cmd->value != BRL_CMD_NOOP) processCommand(table, (command = cmd->value));
+    if (cmd->value != BRL_CMD_NOOP) processCommand(table, (command = cmd->value), 0);
     state = KTS_HOTKEY;
   } else {
     int isImmediate = 1;
@@ -618,7 +647,7 @@ processKeyEvent (
           }
         }
 
-        processCommand(table, command);
+        processCommand(table, command, 0);
       }
     } else {
       resetLongPressData(table);
@@ -627,7 +656,7 @@ processKeyEvent (
         int *cmd = &table->release.command;
 
         if (*cmd != BRL_CMD_NOOP) {
-          processCommand(table, (command = *cmd));
+          processCommand(table, (command = *cmd), 0);
           *cmd = BRL_CMD_NOOP;
         }
       }
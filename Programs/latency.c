@@ -0,0 +1,393 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#include "prologue.h"
+
+#ifdef ENABLE_LATENCY_TRACING
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "strfmt.h"
+#include "latency.h"
+#include "timing.h"
+#include "thread.h"
+#include "parameters.h"
+
+static const char *const latencyStageNames[LATENCY_STAGE_COUNT] = {
+  [LATENCY_STAGE_PACKET] = "packet",
+  [LATENCY_STAGE_KEY] = "key",
+  [LATENCY_STAGE_BINDING] = "binding",
+  [LATENCY_STAGE_QUEUED] = "queued",
+  [LATENCY_STAGE_HANDLED] = "handled",
+  [LATENCY_STAGE_SCHEDULED] = "scheduled",
+  [LATENCY_STAGE_UPDATE] = "update",
+  [LATENCY_STAGE_OUTPUT] = "output",
+};
+
+/* Elapsed times are kept in microseconds within log-linear buckets:
+ * each power of two is split into four sub-buckets.
+ */
+#define LATENCY_SUB_BUCKET_BITS 2
+#define LATENCY_SUB_BUCKET_COUNT (1 << LATENCY_SUB_BUCKET_BITS)
+#define LATENCY_BUCKET_COUNT (32 * LATENCY_SUB_BUCKET_COUNT)
+
+typedef struct {
+  uint32_t counts[LATENCY_BUCKET_COUNT];
+  uint32_t total;
+  uint32_t maximum;
+} LatencyHistogram;
+
+typedef struct {
+  LatencyTrace trace;
+  LatencyStage stage;
+  TimeValue time;
+} LatencyRecord;
+
+typedef struct LatencyThreadDataStruct LatencyThreadData;
+
+struct LatencyThreadDataStruct {
+  LatencyThreadData *next;
+  LatencyThreadData *previous;
+
+  LatencyTrace currentTrace;
+  TimeValue origin;
+  unsigned originActive:1;
+
+  LatencyHistogram histograms[LATENCY_STAGE_COUNT];
+
+  unsigned int recordCount;
+  LatencyRecord records[LATENCY_RECORD_COUNT];
+};
+
+typedef struct {
+  LatencyTrace trace;
+  TimeValue start;
+} LatencyOrigin;
+
+static CriticalSectionLock latencyLock = CRITICAL_SECTION_LOCK_INITIALIZER;
+static LatencyThreadData *latencyThreads = NULL;
+static LatencyHistogram retiredHistograms[LATENCY_STAGE_COUNT];
+
+static LatencyTrace latencyTraceCounter = 0;
+static LatencyOrigin latencyOrigins[LATENCY_ORIGIN_COUNT];
+
+static void
+mergeLatencyHistograms (LatencyHistogram *to, const LatencyHistogram *from) {
+  for (unsigned int stage=0; stage<LATENCY_STAGE_COUNT; stage+=1) {
+    LatencyHistogram *t = &to[stage];
+    const LatencyHistogram *f = &from[stage];
+
+    for (unsigned int bucket=0; bucket<LATENCY_BUCKET_COUNT; bucket+=1) {
+      t->counts[bucket] += f->counts[bucket];
+    }
+
+    t->total += f->total;
+    if (f->maximum > t->maximum) t->maximum = f->maximum;
+  }
+}
+
+static THREAD_SPECIFIC_DATA_NEW(tsdLatency) {
+  LatencyThreadData *ltd;
+
+  if ((ltd = malloc(sizeof(*ltd)))) {
+    memset(ltd, 0, sizeof(*ltd));
+
+    enterCriticalSection(&latencyLock);
+      if ((ltd->next = latencyThreads)) latencyThreads->previous = ltd;
+      latencyThreads = ltd;
+    leaveCriticalSection(&latencyLock);
+
+    return ltd;
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+static THREAD_SPECIFIC_DATA_DESTROY(tsdLatency) {
+  LatencyThreadData *ltd = data;
+
+  if (ltd) {
+    enterCriticalSection(&latencyLock);
+      if (ltd->next) ltd->next->previous = ltd->previous;
+
+      if (ltd->previous) {
+        ltd->previous->next = ltd->next;
+      } else {
+        latencyThreads = ltd->next;
+      }
+
+      mergeLatencyHistograms(retiredHistograms, ltd->histograms);
+    leaveCriticalSection(&latencyLock);
+
+    free(ltd);
+  }
+}
+
+THREAD_SPECIFIC_DATA_CONTROL(tsdLatency);
+
+static LatencyThreadData *
+getLatencyThreadData (void) {
+  return getThreadSpecificData(&tsdLatency);
+}
+
+static uint32_t
+getLatencyMicroseconds (const TimeValue *from, const TimeValue *to) {
+  int64_t microseconds = ((int64_t)(to->seconds - from->seconds) * USECS_PER_SEC)
+                       + ((to->nanoseconds - from->nanoseconds) / NSECS_PER_USEC);
+
+  if (microseconds < 0) return 0;
+  if (microseconds > UINT32_MAX) return UINT32_MAX;
+  return microseconds;
+}
+
+static unsigned int
+getLatencyBucket (uint32_t microseconds) {
+  if (microseconds < LATENCY_SUB_BUCKET_COUNT) return microseconds;
+
+  unsigned int exponent = 31 - __builtin_clz(microseconds);
+  unsigned int shift = exponent - LATENCY_SUB_BUCKET_BITS;
+  unsigned int sub = (microseconds >> shift) & (LATENCY_SUB_BUCKET_COUNT - 1);
+
+  return ((shift + 1) << LATENCY_SUB_BUCKET_BITS) + sub;
+}
+
+static uint32_t
+getLatencyBucketLimit (unsigned int bucket) {
+  if (bucket < LATENCY_SUB_BUCKET_COUNT) return bucket;
+
+  unsigned int shift = (bucket >> LATENCY_SUB_BUCKET_BITS) - 1;
+  uint64_t sub = bucket & (LATENCY_SUB_BUCKET_COUNT - 1);
+  uint64_t limit = ((LATENCY_SUB_BUCKET_COUNT + sub + 1) << shift) - 1;
+
+  return MIN(limit, UINT32_MAX);
+}
+
+static void
+addLatencyRecord (LatencyThreadData *ltd, LatencyTrace trace, LatencyStage stage, const TimeValue *time) {
+  LatencyRecord *record = &ltd->records[ltd->recordCount++ % LATENCY_RECORD_COUNT];
+
+  record->trace = trace;
+  record->stage = stage;
+  record->time = *time;
+}
+
+void
+setLatencyOrigin (int active) {
+  LatencyThreadData *ltd = getLatencyThreadData();
+
+  if (ltd) {
+    if ((ltd->originActive = !!active)) getMonotonicTime(&ltd->origin);
+  }
+}
+
+LatencyTrace
+beginLatencyTrace (void) {
+  LatencyThreadData *ltd = getLatencyThreadData();
+  if (!ltd) return 0;
+
+  TimeValue now;
+  getMonotonicTime(&now);
+
+  const TimeValue *start = ltd->originActive? &ltd->origin: &now;
+  LatencyTrace trace;
+
+  enterCriticalSection(&latencyLock);
+    if (!(trace = ++latencyTraceCounter)) trace = ++latencyTraceCounter;
+
+    LatencyOrigin *origin = &latencyOrigins[trace % LATENCY_ORIGIN_COUNT];
+    origin->trace = trace;
+    origin->start = *start;
+
+    if (ltd->originActive) addLatencyRecord(ltd, trace, LATENCY_STAGE_PACKET, start);
+  leaveCriticalSection(&latencyLock);
+
+  ltd->currentTrace = trace;
+  traceLatency(trace, LATENCY_STAGE_KEY);
+  return trace;
+}
+
+void
+traceLatency (LatencyTrace trace, LatencyStage stage) {
+  if (!trace) return;
+
+  LatencyThreadData *ltd = getLatencyThreadData();
+  if (!ltd) return;
+
+  TimeValue now;
+  getMonotonicTime(&now);
+
+  /* The thread's records and histograms are only written while the lock
+   * is held so that logLatencyStatistics() can read them consistently.
+   */
+  enterCriticalSection(&latencyLock);
+    addLatencyRecord(ltd, trace, stage, &now);
+
+    {
+      const LatencyOrigin *origin = &latencyOrigins[trace % LATENCY_ORIGIN_COUNT];
+
+      if (origin->trace == trace) {
+        LatencyHistogram *histogram = &ltd->histograms[stage];
+        uint32_t microseconds = getLatencyMicroseconds(&origin->start, &now);
+
+        histogram->counts[getLatencyBucket(microseconds)] += 1;
+        histogram->total += 1;
+        if (microseconds > histogram->maximum) histogram->maximum = microseconds;
+      }
+    }
+  leaveCriticalSection(&latencyLock);
+}
+
+LatencyTrace
+getLatencyTrace (void) {
+  LatencyThreadData *ltd = getLatencyThreadData();
+  return ltd? ltd->currentTrace: 0;
+}
+
+void
+setLatencyTrace (LatencyTrace trace) {
+  LatencyThreadData *ltd = getLatencyThreadData();
+  if (ltd) ltd->currentTrace = trace;
+}
+
+static uint32_t
+getLatencyPercentile (const LatencyHistogram *histogram, unsigned int percent) {
+  uint32_t wanted = ((uint64_t)histogram->total * percent + 99) / 100;
+  uint32_t count = 0;
+
+  for (unsigned int bucket=0; bucket<LATENCY_BUCKET_COUNT; bucket+=1) {
+    if ((count += histogram->counts[bucket]) >= wanted) {
+      return MIN(getLatencyBucketLimit(bucket), histogram->maximum);
+    }
+  }
+
+  return histogram->maximum;
+}
+
+static const LatencyRecord *
+findLatencyRecord (LatencyTrace trace, LatencyStage stage) {
+  const LatencyThreadData *ltd = latencyThreads;
+
+  while (ltd) {
+    unsigned int count = MIN(ltd->recordCount, LATENCY_RECORD_COUNT);
+    unsigned int index = ltd->recordCount;
+
+    while (count--) {
+      const LatencyRecord *record = &ltd->records[--index % LATENCY_RECORD_COUNT];
+      if ((record->trace == trace) && (record->stage == stage)) return record;
+    }
+
+    ltd = ltd->next;
+  }
+
+  return NULL;
+}
+
+static void
+formatLatencyTimeline (char *buffer, size_t size, LatencyTrace trace, const TimeValue *start) {
+  STR_BEGIN(buffer, size);
+  STR_PRINTF("latency trace %"PRIu32":", trace);
+
+  for (unsigned int stage=0; stage<LATENCY_STAGE_COUNT; stage+=1) {
+    const LatencyRecord *record = findLatencyRecord(trace, stage);
+
+    if (record) {
+      STR_PRINTF(" %s:%"PRIu32"us", latencyStageNames[stage],
+                 getLatencyMicroseconds(start, &record->time));
+    }
+  }
+
+  STR_END;
+}
+
+static int
+formatLatestLatencyTrace (char *buffer, size_t size) {
+  const LatencyRecord *latest = NULL;
+  const LatencyThreadData *ltd = latencyThreads;
+
+  while (ltd) {
+    unsigned int count = MIN(ltd->recordCount, LATENCY_RECORD_COUNT);
+    unsigned int index = ltd->recordCount;
+
+    while (count--) {
+      const LatencyRecord *record = &ltd->records[--index % LATENCY_RECORD_COUNT];
+
+      if (record->stage == LATENCY_STAGE_OUTPUT) {
+        if (!latest || (compareTimeValues(&record->time, &latest->time) > 0)) latest = record;
+        break;
+      }
+    }
+
+    ltd = ltd->next;
+  }
+
+  if (latest) {
+    LatencyTrace trace = latest->trace;
+    const LatencyOrigin *origin = &latencyOrigins[trace % LATENCY_ORIGIN_COUNT];
+
+    if (origin->trace == trace) {
+      formatLatencyTimeline(buffer, size, trace, &origin->start);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+void
+logLatencyStatistics (void) {
+  LatencyHistogram histograms[LATENCY_STAGE_COUNT];
+  char timeline[0X200];
+  int haveTimeline;
+
+  enterCriticalSection(&latencyLock);
+    memcpy(histograms, retiredHistograms, sizeof(histograms));
+
+    {
+      const LatencyThreadData *ltd = latencyThreads;
+
+      while (ltd) {
+        mergeLatencyHistograms(histograms, ltd->histograms);
+        ltd = ltd->next;
+      }
+    }
+
+    haveTimeline = formatLatestLatencyTrace(timeline, sizeof(timeline));
+  leaveCriticalSection(&latencyLock);
+
+  if (haveTimeline) logMessage(LOG_INFO, "%s", timeline);
+
+  for (unsigned int stage=0; stage<LATENCY_STAGE_COUNT; stage+=1) {
+    const LatencyHistogram *histogram = &histograms[stage];
+
+    if (histogram->total) {
+      logMessage(LOG_INFO,
+        "latency %s: Count:%"PRIu32" P50:%"PRIu32"us P90:%"PRIu32"us P99:%"PRIu32"us Max:%"PRIu32"us",
+        latencyStageNames[stage], histogram->total,
+        getLatencyPercentile(histogram, 50),
+        getLatencyPercentile(histogram, 90),
+        getLatencyPercentile(histogram, 99),
+        histogram->maximum
+      );
+    }
+  }
+}
+#endif /* ENABLE_LATENCY_TRACING */
@@ -23,9 +23,12 @@
 #include "log.h"
 #include "log_history.h"
 #include "timing.h"
+#include "parameters.h"
 
 struct LogEntryStruct {
   struct LogEntryStruct *previous;
+  struct LogEntryStruct *next;
+  unsigned long sequence;
   TimeValue time;
   unsigned int count;
   unsigned noSquash:1;
@@ -52,6 +55,11 @@ getLogEntryCount (const LogEntry *entry) {
   return entry->count;
 }
 
+unsigned long
+getLogEntrySequence (const LogEntry *entry) {
+  return entry->sequence;
+}
+
 int
 pushLogEntry (LogEntry **head, const char *text, LogEntryPushOptions options) {
   int log = !(options & LPO_NOLOG);
@@ -108,20 +116,170 @@ unlockLogMessages (void) {
   leaveCriticalSection(&logMessageLock);
 }
 
-static LogEntry *logMessageStack = NULL;
+typedef union {
+  void *pointer;
+  uint64_t integer;
+} LogMessageAlignment;
+
+static struct {
+  LogMessageAlignment buffer[LOG_HISTORY_BYTE_LIMIT / sizeof(LogMessageAlignment)];
+  size_t offset;
+
+  LogEntry *newest;
+  LogEntry *oldest;
+  unsigned int count;
+  unsigned long sequence;
+} logMessages = {
+  .offset = 0,
+  .newest = NULL,
+  .oldest = NULL,
+  .count = 0,
+  .sequence = 0
+};
+
+static inline size_t
+getLogMessageOffset (const LogEntry *message) {
+  return (const unsigned char *)message - (const unsigned char *)logMessages.buffer;
+}
+
+static void
+discardOldestLogMessage (void) {
+  LogEntry *message = logMessages.oldest;
+
+  if ((logMessages.oldest = message->next)) {
+    logMessages.oldest->previous = NULL;
+  } else {
+    logMessages.newest = NULL;
+  }
+
+  logMessages.count -= 1;
+}
+
+static LogEntry *
+allocateLogMessage (const char *text) {
+  const size_t limit = sizeof(logMessages.buffer) / 8;
+  size_t length = strlen(text);
+  size_t size = sizeof(LogEntry) + length + 1;
+
+  if (size > limit) {
+    size = limit;
+    length = size - sizeof(LogEntry) - 1;
+  }
+
+  {
+    const size_t alignment = sizeof(LogMessageAlignment);
+    size = (size + alignment - 1) / alignment * alignment;
+  }
+
+  if ((logMessages.offset + size) > sizeof(logMessages.buffer)) {
+    /* the space at the end is too small - discard what's there and wrap */
+    while (logMessages.oldest && (getLogMessageOffset(logMessages.oldest) >= logMessages.offset)) {
+      discardOldestLogMessage();
+    }
+
+    logMessages.offset = 0;
+  }
+
+  while (logMessages.oldest) {
+    size_t offset = getLogMessageOffset(logMessages.oldest);
+
+    if (offset < logMessages.offset) break;
+    if (offset >= (logMessages.offset + size)) break;
+    discardOldestLogMessage();
+  }
+
+  while (logMessages.count >= LOG_HISTORY_ENTRY_LIMIT) {
+    discardOldestLogMessage();
+  }
+
+  LogEntry *message = (LogEntry *)((unsigned char *)logMessages.buffer + logMessages.offset);
+  logMessages.offset += size;
+
+  memset(message, 0, sizeof(*message));
+  message->count = 1;
+  message->sequence = ++logMessages.sequence;
+  memcpy(message->text, text, length);
+  message->text[length] = 0;
+
+  if ((message->previous = logMessages.newest)) {
+    logMessages.newest->next = message;
+  } else {
+    logMessages.oldest = message;
+  }
+
+  logMessages.newest = message;
+  logMessages.count += 1;
+  return message;
+}
+
+static LogEntry *
+findSquashableLogMessage (const char *text) {
+  LogEntry *message = logMessages.newest;
+  unsigned int count = LOG_HISTORY_SQUASH_WINDOW;
+
+  while (message && count--) {
+    if (message->noSquash) break;
+    if (strcmp(message->text, text) == 0) return message;
+    message = message->previous;
+  }
+
+  return NULL;
+}
+
+int
+forEachLogMessage (unsigned long after, int freeze, LogMessageHandler *handler, void *data) {
+  /* the ring may be overwritten as soon as it's unlocked so copy the
+   * messages out, and call the handler (which may log) after unlocking
+   */
+  LogEntry *copies = NULL;
+  int ok = 1;
 
-const LogEntry *
-getNewestLogMessage (int freeze) {
   lockLogMessages();
-  LogEntry *message = logMessageStack;
-  if (freeze && message) message->noSquash = 1;
+    LogEntry *message = logMessages.newest;
+    if (freeze && message) message->noSquash = 1;
+
+    while (message && (message->sequence > after)) {
+      size_t size = sizeof(*message) + strlen(message->text) + 1;
+      LogEntry *copy = malloc(size);
+
+      if (!copy) {
+        ok = 0;
+        break;
+      }
+
+      memcpy(copy, message, size);
+      copy->previous = NULL;
+      copy->next = copies;
+      copies = copy;
+
+      message = message->previous;
+    }
   unlockLogMessages();
-  return message;
+
+  if (!ok) logMallocError();
+
+  while (copies) {
+    LogEntry *copy = copies;
+    copies = copy->next;
+
+    if (ok && !handler(copy, data)) ok = 0;
+    free(copy);
+  }
+
+  return ok;
 }
 
 void
 pushLogMessage (const char *message) {
   lockLogMessages();
-  pushLogEntry(&logMessageStack, message, (LPO_NOLOG | LPO_SQUASH));
+    LogEntry *entry = findSquashableLogMessage(message);
+
+    if (entry) {
+      entry->count += 1;
+    } else {
+      entry = allocateLogMessage(message);
+    }
+
+    getCurrentTime(&entry->time);
   unlockLogMessages();
 }
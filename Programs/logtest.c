@@ -0,0 +1,264 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* logtest checks that the log message history stays within its limits */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "log.h"
+#include "log_history.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "parameters.h"
+
+static char *opt_messageCount;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "messages",
+    .letter = 'm',
+    .argument = "count",
+    .setting.string = &opt_messageCount,
+    .internal.setting = "2000000",
+    .description = "how many messages to log"
+  },
+END_OPTION_TABLE
+
+static int messageCount;
+
+static int
+validateOptions (void) {
+  static const int minimum = LOG_HISTORY_ENTRY_LIMIT * 10;
+
+  if (!validateInteger(&messageCount, opt_messageCount, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid message count: %s", opt_messageCount);
+    return 0;
+  }
+
+  return 1;
+}
+
+#define MESSAGE_LENGTH_LIMIT ((LOG_HISTORY_BYTE_LIMIT / 8) + 0X100)
+#define REPEAT_WINDOW LOG_HISTORY_SQUASH_WINDOW
+
+static unsigned long randomState = 1;
+
+static unsigned int
+getRandomNumber (unsigned int limit) {
+  randomState = (randomState * 1103515245) + 12345;
+  return (randomState >> 16) % limit;
+}
+
+/* Each message is determined by its number, and begins with it, so a
+ * repeated number means that the same message is being logged again.
+ */
+static size_t
+makeMessage (char *message, unsigned int number) {
+  size_t length;
+
+  switch (number % 16) {
+    case 0:
+      length = MESSAGE_LENGTH_LIMIT - (number % 0X100); /* too large */
+      break;
+
+    case 1:
+    case 2:
+      length = 0X100 + (number % 0X400);
+      break;
+
+    default:
+      length = 0X10 + (number % 0X40);
+      break;
+  }
+
+  int prefix = snprintf(message, length, "%u:", number);
+
+  for (size_t index=prefix; index<length; index+=1) {
+    message[index] = 'a' + ((number + index) % 26);
+  }
+
+  message[length] = 0;
+  return length;
+}
+
+typedef struct {
+  unsigned long after;
+  const char *logged;
+
+  unsigned long previous;
+  unsigned int count;
+  unsigned int found;
+  size_t bytes;
+  int problem;
+} HistoryWalk;
+
+static int
+checkHistoryMessage (const LogEntry *message, void *data) {
+  HistoryWalk *walk = data;
+  unsigned long sequence = getLogEntrySequence(message);
+  const char *text = getLogEntryText(message);
+
+  if ((sequence <= walk->after) || (sequence <= walk->previous)) {
+    logMessage(LOG_ERR, "log history out of order: %lu after %lu", sequence, walk->previous);
+    walk->problem = 1;
+    return 0;
+  }
+
+  {
+    char expected[MESSAGE_LENGTH_LIMIT + 1];
+    size_t length = strlen(text);
+
+    if ((makeMessage(expected, strtoul(text, NULL, 10)) < length) ||
+        (memcmp(text, expected, length) != 0)) {
+      logMessage(LOG_ERR, "log history message corrupted: %lu", sequence);
+      walk->problem = 1;
+      return 0;
+    }
+  }
+
+  walk->previous = sequence;
+  walk->count += 1;
+  walk->bytes += strlen(text) + 1;
+
+  /* a message which is too large has been truncated */
+  if (walk->logged && (strncmp(text, walk->logged, strlen(text)) == 0)) {
+    walk->found = walk->count;
+  }
+
+  return 1;
+}
+
+typedef struct {
+  unsigned int maximumCount;
+  size_t maximumBytes;
+  unsigned long newestSequence;
+} HistoryUsage;
+
+static int
+checkHistory (const char *logged, HistoryUsage *usage) {
+  HistoryWalk walk = {
+    .after = 0,
+    .logged = logged
+  };
+
+  if (!forEachLogMessage(walk.after, 0, checkHistoryMessage, &walk) || walk.problem) return 0;
+
+  if (walk.count > LOG_HISTORY_ENTRY_LIMIT) {
+    logMessage(LOG_ERR, "too many log history entries: %u", walk.count);
+    return 0;
+  }
+
+  if (walk.bytes > LOG_HISTORY_BYTE_LIMIT) {
+    logMessage(LOG_ERR, "log history too large: %zu", walk.bytes);
+    return 0;
+  }
+
+  /* the message just logged is the newest one unless it was squashed into
+   * a recent copy of it
+   */
+  if (!walk.found || ((walk.count - walk.found) >= LOG_HISTORY_SQUASH_WINDOW)) {
+    logMessage(LOG_ERR, "newest log message isn't in the history");
+    return 0;
+  }
+
+  /* only what's newer than the last walk is seen by a walk which resumes */
+  {
+    HistoryWalk resumed = {
+      .after = usage->newestSequence
+    };
+
+    if (!forEachLogMessage(resumed.after, 0, checkHistoryMessage, &resumed) || resumed.problem) return 0;
+    usage->newestSequence = walk.previous;
+  }
+
+  if (walk.count > usage->maximumCount) usage->maximumCount = walk.count;
+  if (walk.bytes > usage->maximumBytes) usage->maximumBytes = walk.bytes;
+  return 1;
+}
+
+static long int
+getMaximumResidentSize (void) {
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) == -1) return 0;
+  return usage.ru_maxrss;
+}
+
+static int
+testLogMessages (void) {
+  static char message[MESSAGE_LENGTH_LIMIT + 1];
+  HistoryUsage usage = {.maximumCount = 0};
+  long int warmSize = 0;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  for (int number=1; number<=messageCount; number+=1) {
+    unsigned int repeated = number;
+
+    /* a quarter of the messages repeat a recent one (and are squashed) */
+    if ((number > REPEAT_WINDOW) && !getRandomNumber(4)) {
+      repeated -= 1 + getRandomNumber(REPEAT_WINDOW);
+    }
+
+    makeMessage(message, repeated);
+    pushLogMessage(message);
+
+    if (!(number % 0X1000) || (number == messageCount)) {
+      if (!checkHistory(message, &usage)) return 0;
+    }
+
+    if (number == (messageCount / 10)) warmSize = getMaximumResidentSize();
+  }
+
+  long int elapsed = getMonotonicElapsed(&start);
+  long int finalSize = getMaximumResidentSize();
+
+  printf("%d messages in %ldms: at most %u entries and %zu bytes retained, max RSS %ldKB -> %ldKB\n",
+         messageCount, elapsed, usage.maximumCount, usage.maximumBytes, warmSize, finalSize);
+
+  /* the history is statically allocated so nothing should grow */
+  if ((finalSize - warmSize) > ((LOG_HISTORY_BYTE_LIMIT * 2) / 1024)) {
+    logMessage(LOG_ERR, "memory use kept growing");
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "logtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  return testLogMessages()? PROG_EXIT_SUCCESS: PROG_EXIT_FATAL;
+}
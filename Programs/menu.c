@@ -345,6 +345,29 @@ newMenuItem (Menu *menu, unsigned char *setting, const MenuString *name) {
   }
 }
 
+void
+removeMenuItem (Menu *menu, unsigned int index) {
+  MenuItem *item = getMenuItem(menu, index);
+
+  if (item) {
+    if (menu->activeItem == item) {
+      menu->activeItem = NULL;
+    } else if (menu->activeItem && (menu->activeItem > item)) {
+      menu->activeItem -= 1;
+    }
+
+    endMenuItem(item, 1);
+    menu->items.count -= 1;
+    memmove(item, item+1, ((menu->items.count - index) * sizeof(*item)));
+
+    if (menu->items.index > index) {
+      menu->items.index -= 1;
+    } else if (menu->items.index == menu->items.count) {
+      if (menu->items.index) menu->items.index -= 1;
+    }
+  }
+}
+
 void
 setMenuItemTester (MenuItem *item, MenuItemTester *handler) {
   item->test = handler;
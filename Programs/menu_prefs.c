@@ -44,6 +44,7 @@
 #include "leds.h"
 #include "midi.h"
 #include "core.h"
+#include "parameters.h"
 
 #define PREFS_MENU_ITEM_VARIABLE(name) prefsMenuItemVariable_##name
 #define PREFS_MENU_ITEM_GETTER_DECLARE(name) \
@@ -619,43 +620,64 @@ makeMidiInstrumentMenuStrings (void) {
 #endif /* HAVE_MIDI_SUPPORT */
 
 static Menu *logMessagesMenu = NULL;
-static const LogEntry *newestLogMessage = NULL;
+static unsigned long newestLogMessage = 0;
+
+static void
+removeOldestLogMessage (void) {
+  /* item 0 is the close item, and each message item's value is the start
+   * of the single allocation that also holds its label and comment
+   */
+  MenuItem *item = getMenuItem(logMessagesMenu, 1);
+  char *strings = (char *)getMenuItemValue(item);
+
+  removeMenuItem(logMessagesMenu, 1);
+  free(strings);
+}
 
 static int
-addNewLogMessages (const LogEntry *message) {
-  if (message == newestLogMessage) return 1;
-  if (!addNewLogMessages(getPreviousLogEntry(message))) return 0;
+addLogMessage (const LogEntry *message, void *data) {
+  const char *text = getLogEntryText(message);
+  size_t textSize = strlen(text) + 1;
 
-  MenuString name;
-  const TimeValue *time = getLogEntryTime(message);
+  char label[0X20];
+  formatSeconds(label, sizeof(label), "%Y-%m-%d@%H:%M:%S", getLogEntryTime(message)->seconds);
+  size_t labelSize = strlen(label) + 1;
+
+  char comment[0X10];
   unsigned int count = getLogEntryCount(message);
+  snprintf(comment, sizeof(comment), "(%u)", count);
+  size_t commentSize = (count > 1)? (strlen(comment) + 1): 0;
 
-  if (time) {
-    char buffer[0X20];
-    formatSeconds(buffer, sizeof(buffer), "%Y-%m-%d@%H:%M:%S", time->seconds);
-    name.label = strdup(buffer);
-  } else {
-    name.label = NULL;
+  char *strings = malloc(textSize + labelSize + commentSize);
+
+  if (!strings) {
+    logMallocError();
+    return 0;
   }
 
-  if (count > 1) {
-    char buffer[0X10];
-    snprintf(buffer, sizeof(buffer), "(%u)", count);
-    name.comment = strdup(buffer);
-  } else {
-    name.comment = NULL;
+  MenuString name = {
+    .label = memcpy(strings+textSize, label, labelSize),
+    .comment = commentSize? memcpy(strings+textSize+labelSize, comment, commentSize): NULL
+  };
+
+  memcpy(strings, text, textSize);
+
+  while (getMenuSize(logMessagesMenu) > LOG_MESSAGES_MENU_LIMIT) {
+    removeOldestLogMessage();
   }
 
-  MenuItem *item = newTextMenuItem(logMessagesMenu, &name, getLogEntryText(message));
-  if (!item) return 0;
+  if (!newTextMenuItem(logMessagesMenu, &name, strings)) {
+    free(strings);
+    return 0;
+  }
 
-  newestLogMessage = message;
+  newestLogMessage = getLogEntrySequence(message);
   return 1;
 }
 
 int
 updateLogMessagesSubmenu (void) {
-  return addNewLogMessages(getNewestLogMessage(1));
+  return forEachLogMessage(newestLogMessage, 1, addLogMessage, NULL);
 }
 
 static Menu *
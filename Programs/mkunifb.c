@@ -0,0 +1,340 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+/* mkunifb - generate the Unicode lookup tables
+ *
+ * Each table is written as a C header which defines two-stage (row then
+ * cell) arrays. Identical rows are only written once. The headers are
+ * committed (as unicode_<name>.h) so that the lookups don't need ICU or
+ * iconv, nor call them per character, at run time.
+ *
+ * fallback: each character's base character (its first NFD component) and
+ *           its single-character ASCII transliteration
+ * width:    the number of columns each character occupies
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <locale.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "unicode.h"
+
+static char *opt_tableName;
+static char *opt_localeName;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "table",
+    .letter = 't',
+    .argument = "name",
+    .setting.string = &opt_tableName,
+    .internal.setting = "fallback",
+    .description = "the table to generate (fallback or width)"
+  },
+
+  { .word = "locale",
+    .letter = 'l',
+    .argument = "name",
+    .setting.string = &opt_localeName,
+    .internal.setting = "C.UTF-8",
+    .description = "the locale to transliterate within"
+  },
+END_OPTION_TABLE
+
+/* all 17 planes - UNICODE_LAST_CHARACTER stops short of the last row */
+#define ROW_COUNT (17 * UNICODE_ROWS_PER_PLANE)
+
+typedef int ValueGetter (wchar_t character);
+
+typedef struct {
+  const char *name;
+  const char *type;
+  const char *valueType;
+  const char *valueFormat;
+  ValueGetter *getValue;
+  unsigned fullRange:1;
+
+  uint16_t rows[ROW_COUNT];
+  unsigned int rowLimit;
+
+  int (*cells)[UNICODE_CELLS_PER_ROW];
+  unsigned int cellsCount;
+} UnicodeTable;
+
+static int
+getBaseValue (wchar_t character) {
+  if (isHangulSyllable(character)) return 0;
+
+  wchar_t base = getBaseCharacter(character);
+  return (base == character)? 0: base;
+}
+
+static int
+getTransliterationValue (wchar_t character) {
+  wchar_t transliteration = getTransliteratedCharacter(character);
+  return (transliteration == character)? 0: transliteration;
+}
+
+static int
+getWidthValue (wchar_t character) {
+  return computeCharacterWidth(character);
+}
+
+static int
+findRow (const UnicodeTable *table, const int *row) {
+  for (unsigned int index=0; index<table->cellsCount; index+=1) {
+    if (memcmp(table->cells[index], row, sizeof(table->cells[index])) == 0) {
+      return index;
+    }
+  }
+
+  return -1;
+}
+
+static int
+makeUnicodeTable (UnicodeTable *table) {
+  int row[UNICODE_CELLS_PER_ROW];
+
+  /* row zero of the cells is the (possibly unused) all-zero row */
+  if (!(table->cells = calloc(1, sizeof(*table->cells)))) {
+    logMallocError();
+    return 0;
+  }
+
+  table->cellsCount = 1;
+  table->rowLimit = 0;
+
+  for (unsigned int rowNumber=0; rowNumber<ROW_COUNT; rowNumber+=1) {
+    for (unsigned int cellNumber=0; cellNumber<UNICODE_CELLS_PER_ROW; cellNumber+=1) {
+      wchar_t character = (rowNumber << UNICODE_ROW_SHIFT) | cellNumber;
+      int value = 0;
+
+      if ((character < UNICODE_SURROGATE_BEGIN) || (character > UNICODE_SURROGATE_END)) {
+        value = table->getValue(character);
+      }
+
+      row[cellNumber] = value;
+    }
+
+    int index = findRow(table, row);
+
+    if (index < 0) {
+      if (table->cellsCount > UINT8_MAX) {
+        logMessage(LOG_ERR, "too many %s rows", opt_tableName);
+        return 0;
+      }
+
+      {
+        unsigned int count = table->cellsCount + 1;
+        void *cells = realloc(table->cells, (count * sizeof(*table->cells)));
+
+        if (!cells) {
+          logMallocError();
+          return 0;
+        }
+
+        table->cells = cells;
+      }
+
+      memcpy(table->cells[index = table->cellsCount++], row, sizeof(row));
+    }
+
+    table->rows[rowNumber] = index;
+    if (index || table->fullRange) table->rowLimit = rowNumber + 1;
+  }
+
+  return 1;
+}
+
+static void
+writeUnicodeTable (const UnicodeTable *table) {
+  printf("\n#define UNICODE_%s_ROW_LIMIT 0X%X\n", table->name, table->rowLimit);
+
+  printf("\nstatic const unsigned char unicode%sRows[UNICODE_%s_ROW_LIMIT] = {",
+         table->type, table->name);
+
+  for (unsigned int rowNumber=0; rowNumber<table->rowLimit; rowNumber+=1) {
+    if (!(rowNumber % 0X10)) printf("\n ");
+    printf(" %u,", table->rows[rowNumber]);
+  }
+
+  printf("\n};\n");
+
+  printf("\nstatic const %s unicode%sCells[][UNICODE_CELLS_PER_ROW] = {",
+         table->valueType, table->type);
+
+  for (unsigned int index=0; index<table->cellsCount; index+=1) {
+    printf("\n  {");
+
+    for (unsigned int cellNumber=0; cellNumber<UNICODE_CELLS_PER_ROW; cellNumber+=1) {
+      if (!(cellNumber % 0X10)) printf("\n   ");
+      printf(" ");
+      printf(table->valueFormat, table->cells[index][cellNumber]);
+      printf(",");
+    }
+
+    printf("\n  },\n");
+  }
+
+  printf("};\n");
+}
+
+static int
+verifyHangulSyllables (void) {
+  for (wchar_t syllable=UNICODE_HANGUL_SYLLABLE_FIRST;
+       syllable<=UNICODE_HANGUL_SYLLABLE_LAST;
+       syllable+=1) {
+    wchar_t expected = getBaseCharacter(syllable);
+    wchar_t actual = getHangulSyllableBase(syllable);
+
+    if (actual != expected) {
+      logMessage(LOG_ERR, "Hangul syllable base mismatch: U+%04X: %04X != %04X",
+                 syllable, actual, expected);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static UnicodeTable fallbackTables[] = {
+  { .name = "FALLBACK_BASE",
+    .type = "FallbackBase",
+    .valueType = "uint16_t",
+    .valueFormat = "0X%04X",
+    .getValue = getBaseValue
+  },
+
+  { .name = "FALLBACK_TRANSLITERATION",
+    .type = "FallbackTransliteration",
+    .valueType = "uint8_t",
+    .valueFormat = "0X%02X",
+    .getValue = getTransliterationValue
+  },
+};
+
+static UnicodeTable widthTables[] = {
+  { .name = "WIDTH",
+    .type = "Width",
+    .valueType = "signed char",
+    .valueFormat = "%2d",
+    .getValue = getWidthValue,
+    .fullRange = 1
+  },
+};
+
+static int
+prepareFallbackTables (void) {
+  if (!(getBaseCharacter(0XE9) && getTransliteratedCharacter(0X201C))) {
+    logMessage(LOG_ERR, "ICU and iconv are needed to generate the fallback tables");
+    return 0;
+  }
+
+  return verifyHangulSyllables();
+}
+
+static int
+prepareWidthTables (void) {
+  if (computeCharacterWidth(0X4E00) != 2) {
+    logMessage(LOG_ERR, "ICU is needed to generate the width table");
+    return 0;
+  }
+
+  return 1;
+}
+
+typedef struct {
+  const char *name;
+  const char *macroName;
+  int (*prepare) (void);
+  UnicodeTable *tables;
+  unsigned int count;
+} TableSetEntry;
+
+static const TableSetEntry tableSets[] = {
+  { .name = "fallback",
+    .macroName = "FALLBACK",
+    .prepare = prepareFallbackTables,
+    .tables = fallbackTables,
+    .count = ARRAY_COUNT(fallbackTables)
+  },
+
+  { .name = "width",
+    .prepare = prepareWidthTables,
+    .tables = widthTables,
+    .count = ARRAY_COUNT(widthTables)
+  },
+};
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "mkunifb"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  const TableSetEntry *set = NULL;
+
+  for (unsigned int index=0; index<ARRAY_COUNT(tableSets); index+=1) {
+    if (strcmp(opt_tableName, tableSets[index].name) == 0) {
+      set = &tableSets[index];
+      break;
+    }
+  }
+
+  if (!set) {
+    logMessage(LOG_ERR, "unknown table: %s", opt_tableName);
+    return PROG_EXIT_SYNTAX;
+  }
+
+  if (!setlocale(LC_ALL, opt_localeName)) {
+    logMessage(LOG_ERR, "locale not supported: %s", opt_localeName);
+    return PROG_EXIT_SEMANTIC;
+  }
+
+  if (!set->prepare()) return PROG_EXIT_FATAL;
+
+  printf("/* This file was generated by mkunifb (table %s, locale %s) - do not edit it.\n",
+         set->name, opt_localeName);
+  printf(" * Regenerate it with: make -C Programs unicode-tables\n");
+  printf(" */\n");
+
+  if (set->macroName) {
+    /* what the table holds depends on the locale */
+    printf("\n#define UNICODE_%s_LOCALE \"%s\"\n", set->macroName, opt_localeName);
+  }
+
+  for (unsigned int index=0; index<set->count; index+=1) {
+    UnicodeTable *table = &set->tables[index];
+
+    if (!makeUnicodeTable(table)) return PROG_EXIT_FATAL;
+    writeUnicodeTable(table);
+    free(table->cells);
+  }
+
+  return PROG_EXIT_SUCCESS;
+}
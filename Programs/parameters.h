@@ -26,10 +26,36 @@ extern "C" {
 #define PROGRAM_TERMINATION_REQUEST_COUNT_THRESHOLD 3
 #define PROGRAM_TERMINATION_REQUEST_RESET_SECONDS 5
 
+#define ASYNC_EVENT_MAILBOX_SIZE 0X2000
+
+#define QUEUE_ELEMENT_CACHE_LIMIT 0X40
+
+#define CLIPBOARD_HISTORY_ENTRY_LIMIT 0X40
+#define CLIPBOARD_HISTORY_BYTE_LIMIT 0X40000
+
+#define LOG_HISTORY_ENTRY_LIMIT 0X400
+#define LOG_HISTORY_BYTE_LIMIT 0X20000
+#define LOG_HISTORY_SQUASH_WINDOW 4
+#define LOG_MESSAGES_MENU_LIMIT LOG_HISTORY_ENTRY_LIMIT
+
+#define SESSION_DIRECT_LIMIT 0X40
+#define SESSION_HASH_SIZE 0X40
+#define SESSION_ENTRY_LIMIT 0X100
+#define SESSION_IDLE_LIMIT (60 * 60 * 1000)
+#define SESSION_POOL_SIZE 8
+
+#define COMMAND_QUEUE_SIZE 0X40
+#define COMMAND_QUEUE_BATCH_SIZE 8
+
+#define LATENCY_RECORD_COUNT 0X100
+#define LATENCY_ORIGIN_COUNT 0X40
+
 #define DEFAULT_ACTIVITY_START_TIMEOUT 1000
 #define DEFAULT_ACTIVITY_STOP_TIMEOUT 1000
 
 #define BRAILLE_DRIVER_START_RETRY_INTERVAL 5000
+#define BRAILLE_DRIVER_START_UEVENT_RETRY_INTERVAL 60000
+#define BRAILLE_DRIVER_DEVICE_ADDED_DELAY 500
 #define BRAILLE_DRIVER_INPUT_POLL_INTERVAL 40
 
 #define BRAILLE_MESSAGE_ACKNOWLEDGEMENT_TIMEOUT 1000
@@ -42,6 +68,9 @@ extern "C" {
 #define SPEECH_DRIVER_THREAD_STOP_TIMEOUT 5000
 
 #define SPEECH_RESPONSE_WAIT_TIMEOUT 5000
+#define SPEECH_REQUEST_PIPELINE_DEPTH 8
+#define SPEECH_REQUEST_POOL_SIZE 0X20
+#define SPEECH_REQUEST_DATA_SIZE 0X400
 
 #define SCREEN_DRIVER_START_RETRY_INTERVAL 5000
 #define SCREEN_FREEZE_REMINDER_INTERVAL 30000
@@ -49,13 +78,14 @@ extern "C" {
 #define SCREEN_UPDATE_SCHEDULE_DELAY 5
 
 #define KEYBOARD_MONITOR_START_RETRY_INTERVAL 5000
+#define UEVENT_MONITOR_RESTART_INTERVAL 5000
 
 #define PID_FILE_CREATE_RETRY_INTERVAL 5000
 
 #define UPDATE_SCHEDULE_DELAY 15
 
-#define ROUTING_PROCESS_NICENESS 10
-#define ROUTING_POLL_INTERVAL 1
+#define ROUTING_POLL_INTERVAL 10
+#define ROUTING_KEY_BATCH_LIMIT 8
 #define ROUTING_MAXIMUM_TIMEOUT 2000
 
 #define TUNE_DEVICE_CLOSE_DELAY 2000
@@ -72,6 +102,7 @@ extern "C" {
 #define GPM_CONNECTION_RESET_DELAY 5000
 
 #define GIO_USB_INPUT_MONITOR_DISABLE 0
+#define GIO_REPLAY_POLL_INTERVAL 1
 
 #define SERIAL_DEVICE_RESTART_DELAY 500
 
@@ -84,6 +115,11 @@ extern "C" {
 #define BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT 2000
 #define BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL 100
 #define BLUETOOTH_CHANNEL_CONNECT_TIMEOUT 15000
+#define BLUETOOTH_CACHE_NAME_SECONDS (30 * 24 * 60 * 60)
+#define BLUETOOTH_CACHE_CHANNEL_SECONDS (7 * 24 * 60 * 60)
+#define BLUETOOTH_CACHE_DRIVER_SECONDS (30 * 24 * 60 * 60)
+#define BLUETOOTH_CACHE_ERROR_SECONDS 30
+#define BLUETOOTH_CACHE_REFRESH_SECONDS (24 * 60 * 60)
 
 #define LINUX_INPUT_DEVICE_OPEN_DELAY 1000
 #define LINUX_USB_INPUT_PIPE_DISABLE 0
@@ -0,0 +1,602 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* quetest stresses queues which are used by many threads at once,
+ * and times the lookups of an indexed queue
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+#define GOT_MALLINFO2
+#include <malloc.h>
+#endif /* mallinfo2 */
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "queue.h"
+#include "async_io.h"
+#include "parameters.h"
+
+static char *opt_threadCount;
+static char *opt_operationCount;
+static char *opt_descriptorCount;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "threads",
+    .letter = 't',
+    .argument = "count",
+    .setting.string = &opt_threadCount,
+    .internal.setting = "8",
+    .description = "how many threads use the queues"
+  },
+
+  { .word = "operations",
+    .letter = 'o',
+    .argument = "count",
+    .setting.string = &opt_operationCount,
+    .internal.setting = "200000",
+    .description = "how many items each thread queues"
+  },
+
+  { .word = "descriptors",
+    .letter = 'd',
+    .argument = "count",
+    .setting.string = &opt_descriptorCount,
+    .internal.setting = "4096",
+    .description = "how many file descriptors are monitored"
+  },
+END_OPTION_TABLE
+
+static int threadCount;
+static int operationCount;
+static int descriptorCount;
+
+static int
+validateOptions (void) {
+  {
+    static const int minimum = 1;
+    static const int maximum = 64;
+
+    if (!validateInteger(&threadCount, opt_threadCount, &minimum, &maximum)) {
+      logMessage(LOG_ERR, "invalid thread count: %s", opt_threadCount);
+      return 0;
+    }
+  }
+
+  {
+    static const int minimum = QUEUE_ELEMENT_CACHE_LIMIT;
+
+    if (!validateInteger(&operationCount, opt_operationCount, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid operation count: %s", opt_operationCount);
+      return 0;
+    }
+  }
+
+  {
+    static const int minimum = 0X10;
+
+    if (!validateInteger(&descriptorCount, opt_descriptorCount, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid descriptor count: %s", opt_descriptorCount);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static Queue *sharedQueue;
+static pthread_mutex_t sharedMutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned char *consumedItems;
+static unsigned long itemsConsumed;
+static int problem;
+
+static void
+reportProblem (const char *message, unsigned long number) {
+  pthread_mutex_lock(&sharedMutex);
+    if (!problem) logMessage(LOG_ERR, "%s: %lu", message, number);
+    problem = 1;
+  pthread_mutex_unlock(&sharedMutex);
+}
+
+static void
+consumeItem (void *item) {
+  unsigned long number = (uintptr_t)item;
+
+  if (consumedItems[number]) {
+    reportProblem("item consumed twice", number);
+  } else {
+    consumedItems[number] = 1;
+    itemsConsumed += 1;
+  }
+}
+
+/* Each thread churns its own queue, so that elements keep moving between
+ * its cache and the pool, and passes items to the other threads through
+ * a shared queue, so that elements are freed by threads other than the
+ * ones which allocated them.
+ */
+static void *
+runQueueStress (void *argument) {
+  unsigned long first = (uintptr_t)argument * operationCount;
+  unsigned long state = first + 1;
+  Queue *queue = newQueue(NULL, NULL);
+
+  if (!queue) {
+    reportProblem("queue not created", first);
+    return NULL;
+  }
+
+  for (unsigned long number=first; number<(first + operationCount); number+=1) {
+    state = (state * 1103515245) + 12345;
+
+    if (!enqueueItem(queue, (void *)(uintptr_t)(number + 1))) {
+      reportProblem("item not queued", number);
+      break;
+    }
+
+    /* let the private queue grow to a few caches' worth now and then */
+    if (getQueueSize(queue) > ((state >> 16) % (QUEUE_ELEMENT_CACHE_LIMIT * 4))) {
+      while (getQueueSize(queue) > 1) {
+        Element *element = getQueueHead(queue);
+
+        if (getElementIdentifier(element) <= 0) {
+          reportProblem("invalid element identifier", number);
+        }
+
+        deleteElement(element);
+      }
+    }
+
+    pthread_mutex_lock(&sharedMutex);
+      if (!enqueueItem(sharedQueue, (void *)(uintptr_t)(number + 1))) {
+        if (!problem) logMessage(LOG_ERR, "item not shared: %lu", number);
+        problem = 1;
+      }
+
+      if ((state >> 20) & 1) {
+        void *item;
+        if ((item = dequeueItem(sharedQueue))) consumeItem(item);
+      }
+    pthread_mutex_unlock(&sharedMutex);
+  }
+
+  deallocateQueue(queue);
+  return NULL;
+}
+
+static int
+runThreads (void *(*run) (void *argument)) {
+  pthread_t threads[threadCount];
+  int started = 0;
+
+  while (started < threadCount) {
+    int error = pthread_create(&threads[started], NULL, run, (void *)(uintptr_t)started);
+
+    if (error) {
+      logActionError(error, "pthread_create");
+      problem = 1;
+      break;
+    }
+
+    started += 1;
+  }
+
+  while (started > 0) pthread_join(threads[--started], NULL);
+  return !problem;
+}
+
+static int
+testQueueStress (void) {
+  unsigned long itemCount = (unsigned long)threadCount * operationCount;
+
+  if (!(consumedItems = calloc(itemCount + 1, 1))) {
+    logMallocError();
+    return 0;
+  }
+
+  int ok = 0;
+
+  if ((sharedQueue = newQueue(NULL, NULL))) {
+    TimeValue start;
+    getMonotonicTime(&start);
+
+    if (runThreads(runQueueStress)) {
+      void *item;
+
+      while ((item = dequeueItem(sharedQueue))) consumeItem(item);
+      long int elapsed = getMonotonicElapsed(&start);
+
+      printf("%d threads, %lu items: %ldms, %lu items accounted for\n",
+             threadCount, itemCount, elapsed, itemsConsumed);
+
+      if (problem) {
+      } else if (itemsConsumed != itemCount) {
+        logMessage(LOG_ERR, "items lost: %lu", (itemCount - itemsConsumed));
+      } else {
+        ok = 1;
+      }
+    }
+
+    deallocateQueue(sharedQueue);
+  }
+
+  free(consumedItems);
+  return ok;
+}
+
+/* The items of the keyed lookup test are like the monitors of the async
+ * I/O module: they're keyed by file descriptor, and some descriptors have
+ * more than one of them.
+ */
+typedef struct {
+  int fileDescriptor;
+  int method;
+} KeyedItem;
+
+static ItemKey
+makeKeyedItemKey (const void *item, void *queueData) {
+  const KeyedItem *keyed = item;
+  return keyed->fileDescriptor;
+}
+
+static int
+testKeyedItem (const void *item, void *data) {
+  const KeyedItem *keyed = item;
+  const KeyedItem *wanted = data;
+
+  return (keyed->fileDescriptor == wanted->fileDescriptor)
+      && (keyed->method == wanted->method);
+}
+
+static int
+findKeyedItems (Queue *queue, const KeyedItem *items, int count, const unsigned char *deleted) {
+  unsigned long state = 1;
+
+  for (int counter=0; counter<count; counter+=1) {
+    state = (state * 1103515245) + 12345;
+
+    const KeyedItem *item = &items[(state >> 8) % count];
+    const KeyedItem *found = findItemWithKey(queue, item->fileDescriptor, testKeyedItem, (void *)item);
+    int index = item - items;
+
+    if (found != ((deleted && deleted[index])? NULL: item)) {
+      logMessage(LOG_ERR, "wrong item found: fd %d method %d",
+                 item->fileDescriptor, item->method);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/* a lookup in an indexed queue is far too quick to be timed by itself */
+static int
+timeKeyedLookups (Queue *queue, const KeyedItem *items, int count, long int *nanoseconds) {
+  long long int lookups = 0;
+  long int elapsed;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  do {
+    if (!findKeyedItems(queue, items, count, NULL)) return 0;
+    lookups += count;
+  } while ((elapsed = getMonotonicElapsed(&start)) < 100);
+
+  *nanoseconds = (long int)(((long long int)elapsed * 1000000) / lookups);
+  return 1;
+}
+
+static int
+testKeyedQueue (Queue *queue, KeyedItem *items, int count, long int *nanoseconds) {
+  for (int index=0; index<count; index+=1) {
+    if (!enqueueItem(queue, &items[index])) return 0;
+  }
+
+  if (!timeKeyedLookups(queue, items, count, nanoseconds)) return 0;
+
+  /* what's deleted mustn't be found, and the rest must still be */
+  {
+    unsigned char *deleted = calloc(count, 1);
+    int ok = 1;
+
+    if (!deleted) {
+      logMallocError();
+      return 0;
+    }
+
+    for (int index=0; index<count; index+=3) {
+      if (!deleteItem(queue, &items[index])) {
+        logMessage(LOG_ERR, "item not deleted: %d", index);
+        ok = 0;
+        break;
+      }
+
+      deleted[index] = 1;
+    }
+
+    if (ok) ok = findKeyedItems(queue, items, count, deleted);
+    free(deleted);
+    if (!ok) return 0;
+
+    for (int index=0; index<count; index+=3) {
+      if (!enqueueItem(queue, &items[index])) return 0;
+    }
+  }
+
+  if (!findKeyedItems(queue, items, count, NULL)) return 0;
+
+  {
+    KeyedItem missing = {
+      .fileDescriptor = descriptorCount,
+      .method = 0
+    };
+
+    if (findItemWithKey(queue, missing.fileDescriptor, testKeyedItem, &missing)) {
+      logMessage(LOG_ERR, "missing item found");
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int
+testKeyedLookups (void) {
+  int count = descriptorCount + (descriptorCount / 2);
+  KeyedItem *items = malloc(count * sizeof(*items));
+
+  if (!items) {
+    logMallocError();
+    return 0;
+  }
+
+  {
+    KeyedItem *item = items;
+
+    /* half of the descriptors are monitored for both input and output */
+    for (int descriptor=0; descriptor<descriptorCount; descriptor+=1) {
+      *item++ = (KeyedItem){.fileDescriptor=descriptor, .method=0};
+      if (descriptor & 1) *item++ = (KeyedItem){.fileDescriptor=descriptor, .method=1};
+    }
+
+    count = item - items;
+  }
+
+  int ok = 0;
+  Queue *indexed = newQueue(NULL, NULL);
+  Queue *linear = newQueue(NULL, NULL);
+
+  if (indexed && linear && setQueueKeyMaker(indexed, makeKeyedItemKey)) {
+    long int indexedTime, linearTime;
+
+    if (testKeyedQueue(indexed, items, count, &indexedTime) &&
+        testKeyedQueue(linear, items, count, &linearTime)) {
+      printf("%d descriptors, %d monitors: indexed %ldns, linear %ldns per lookup\n",
+             descriptorCount, count, indexedTime, linearTime);
+
+      ok = 1;
+    }
+  }
+
+  if (linear) deallocateQueue(linear);
+  if (indexed) deallocateQueue(indexed);
+  free(items);
+  return ok;
+}
+
+static
+ASYNC_MONITOR_CALLBACK(handleMonitoredInput) {
+  return 0;
+}
+
+/* Adding a monitor looks up the entry for its file descriptor, so it's
+ * only as fast as that lookup when there are thousands of them.
+ */
+static int
+testFileMonitors (void) {
+  int *descriptors = malloc(descriptorCount * sizeof(*descriptors));
+  AsyncHandle *handles = malloc(descriptorCount * sizeof(*handles));
+  int opened = 0;
+  int monitored = 0;
+  int ok = 0;
+
+  if (!descriptors || !handles) {
+    logMallocError();
+    goto done;
+  }
+
+  while (opened < descriptorCount) {
+    int descriptor = open("/dev/null", O_RDONLY);
+
+    if (descriptor == -1) {
+      if (errno == EMFILE) break;
+      logSystemError("open");
+      goto done;
+    }
+
+    descriptors[opened++] = descriptor;
+  }
+
+  {
+    TimeValue start;
+    getMonotonicTime(&start);
+
+    while (monitored < opened) {
+      if (!asyncMonitorFileInput(&handles[monitored], descriptors[monitored],
+                                 handleMonitoredInput, NULL)) {
+        logMessage(LOG_ERR, "file descriptor not monitored: %d", descriptors[monitored]);
+        goto done;
+      }
+
+      monitored += 1;
+    }
+
+    long int added = getMonotonicElapsed(&start);
+    getMonotonicTime(&start);
+
+    while (monitored > 0) asyncCancelRequest(handles[--monitored]);
+    long int cancelled = getMonotonicElapsed(&start);
+
+    printf("%d monitored file descriptors: %ldms to add, %ldms to cancel\n",
+           opened, added, cancelled);
+  }
+
+  ok = 1;
+
+done:
+  while (monitored > 0) asyncCancelRequest(handles[--monitored]);
+  while (opened > 0) close(descriptors[--opened]);
+  if (handles) free(handles);
+  if (descriptors) free(descriptors);
+  return ok;
+}
+
+#ifdef GOT_MALLINFO2
+static pthread_cond_t parkedCondition = PTHREAD_COND_INITIALIZER;
+static int parkedThreads;
+static int threadsReleased;
+
+/* Fill this thread's cache, and then wait, still running, until the
+ * program has exited the queue module.
+ */
+static void *
+runParkedThread (void *argument) {
+  Queue *queue;
+
+  /* the first queue after an exit registers the exit handler again */
+  pthread_mutex_lock(&sharedMutex);
+    queue = newQueue(NULL, NULL);
+  pthread_mutex_unlock(&sharedMutex);
+
+  if (queue) {
+    for (unsigned int count=0; count<QUEUE_ELEMENT_CACHE_LIMIT; count+=1) {
+      enqueueItem(queue, argument);
+    }
+
+    deleteElements(queue);
+    deallocateQueue(queue);
+  }
+
+  pthread_mutex_lock(&sharedMutex);
+    parkedThreads += 1;
+    pthread_cond_broadcast(&parkedCondition);
+    while (!threadsReleased) pthread_cond_wait(&parkedCondition, &sharedMutex);
+  pthread_mutex_unlock(&sharedMutex);
+
+  return NULL;
+}
+
+static void *
+runParkedThreads (void *argument) {
+  runThreads(runParkedThread);
+  return NULL;
+}
+
+static long int
+getAllocatedSize (void) {
+  return mallinfo2().uordblks;
+}
+
+/* The element caches of threads which are still running when the program
+ * exits must be freed too.
+ */
+static int
+testRunningThreadCaches (void) {
+  /* start with nothing cached */
+  endProgram();
+  long int emptySize = getAllocatedSize();
+
+  pthread_t thread;
+  int error = pthread_create(&thread, NULL, runParkedThreads, NULL);
+
+  if (error) {
+    logActionError(error, "pthread_create");
+    return 0;
+  }
+
+  pthread_mutex_lock(&sharedMutex);
+    while (parkedThreads < threadCount) pthread_cond_wait(&parkedCondition, &sharedMutex);
+  pthread_mutex_unlock(&sharedMutex);
+
+  long int cachedSize = getAllocatedSize();
+  endProgram();
+  long int exitedSize = getAllocatedSize();
+
+  pthread_mutex_lock(&sharedMutex);
+    threadsReleased = 1;
+    pthread_cond_broadcast(&parkedCondition);
+  pthread_mutex_unlock(&sharedMutex);
+  pthread_join(thread, NULL);
+
+  printf("%d running threads: %ld bytes allocated, %ld bytes freed by exit\n",
+         threadCount, (cachedSize - emptySize), (cachedSize - exitedSize));
+
+  /* an element has (at least) five pointers - what the threads themselves
+   * have allocated isn't freed until they exit
+   */
+  if ((cachedSize - exitedSize) < (long int)(threadCount * QUEUE_ELEMENT_CACHE_LIMIT * sizeof(void *) * 5)) {
+    logMessage(LOG_ERR, "cached elements not freed");
+    return 0;
+  }
+
+  return 1;
+}
+#endif /* GOT_MALLINFO2 */
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "quetest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+
+#ifdef GOT_MALLINFO2
+  /* so that the allocation counts include the memory of every thread */
+  mallopt(M_ARENA_MAX, 1);
+#endif /* GOT_MALLINFO2 */
+
+  if (!testQueueStress()) return PROG_EXIT_FATAL;
+  if (!testKeyedLookups()) return PROG_EXIT_FATAL;
+  if (!testFileMonitors()) return PROG_EXIT_FATAL;
+
+#ifdef GOT_MALLINFO2
+  if (!testRunningThreadCaches()) return PROG_EXIT_FATAL;
+#endif /* GOT_MALLINFO2 */
+
+  return PROG_EXIT_SUCCESS;
+}
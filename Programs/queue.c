@@ -18,29 +18,18 @@
 
 #include "prologue.h"
 
+#include <limits.h>
+
 #include "log.h"
 #include "queue.h"
 #include "lock.h"
+#include "thread.h"
 #include "program.h"
+#include "parameters.h"
 
-static Element *discardedElements = NULL;
-
-static LockDescriptor *
-getDiscardedElementsLock (void) {
-  static LockDescriptor *lock = NULL;
-
-  return getLockDescriptor(&lock, "queue-discarded-elements");
-}
-
-static void
-lockDiscardedElements (void) {
-  obtainExclusiveLock(getDiscardedElementsLock());
-}
-
-static void
-unlockDiscardedElements (void) {
-  releaseLock(getDiscardedElementsLock());
-}
+#if defined(GOT_PTHREADS) && defined(HAVE_SYNC_BOOL_COMPARE_AND_SWAP) && defined(__GNUC__)
+#define QUEUE_ELEMENT_POOLS
+#endif /* element pools */
 
 struct QueueStruct {
   Element *head;
@@ -48,6 +37,12 @@ struct QueueStruct {
   void *data;
   ItemDeallocator *deallocateItem;
   ItemComparator *compareItems;
+
+  struct {
+    ItemKeyMaker *makeKey;
+    Element **buckets;
+    unsigned char bits;
+  } index;
 };
 
 struct ElementStruct {
@@ -56,42 +51,233 @@ struct ElementStruct {
   Queue *queue;
   int identifier;
   void *item;
+
+  Element *nextWithKey;
+  ItemKey key;
 };
 
+#ifdef QUEUE_ELEMENT_POOLS
+/* Each thread keeps a small cache of discarded elements. Full caches are
+ * pushed, as a batch, onto a lock-free global pool, and an empty cache is
+ * refilled by taking one batch from it. While an element is discarded, next
+ * links it within its batch, previous (of the first element) links to the
+ * next batch, and identifier (of the first element) holds the batch size.
+ *
+ * The pool is only ever emptied as a whole (and what isn't wanted is pushed
+ * back), so the compare-and-swap operations aren't exposed to ABA problems.
+ */
+
+typedef struct ElementCacheStruct ElementCache;
+
+struct ElementCacheStruct {
+  ElementCache *next;
+  ElementCache *previous;
+
+  Element *elements;
+  unsigned int count;
+  unsigned registered:1;
+};
+
+static Element *pooledElements = NULL;
+static __thread ElementCache elementCache;
+
+static pthread_key_t elementCacheKey;
+static pthread_once_t elementCacheOnce = PTHREAD_ONCE_INIT;
+
+/* The caches of all live threads are tracked so that those of threads which
+ * are still running when the program exits can be freed too.
+ */
+static ElementCache *elementCaches = NULL;
+static pthread_mutex_t elementCachesMutex = PTHREAD_MUTEX_INITIALIZER;
+
 static void
-addElement (Queue *queue, Element *element) {
-  {
-    static int identifier = 0;
-    element->identifier = ++identifier;
+pushElementBatches (Element *first, Element *last) {
+  Element *head;
+
+  do {
+    head = pooledElements;
+    last->previous = head;
+  } while (!__sync_bool_compare_and_swap(&pooledElements, head, first));
+}
+
+static Element *
+takeElementBatches (void) {
+  Element *head;
+
+  do {
+    if (!(head = pooledElements)) return NULL;
+  } while (!__sync_bool_compare_and_swap(&pooledElements, head, NULL));
+
+  return head;
+}
+
+static void
+flushElementCache (ElementCache *cache) {
+  Element *batch = cache->elements;
+
+  if (batch) {
+    batch->identifier = cache->count;
+    pushElementBatches(batch, batch);
+
+    cache->elements = NULL;
+    cache->count = 0;
   }
+}
 
-  element->queue = queue;
-  queue->size += 1;
+static void
+refillElementCache (ElementCache *cache) {
+  Element *batch = takeElementBatches();
+
+  if (batch) {
+    Element *rest = batch->previous;
+
+    if (rest) {
+      Element *last = rest;
+      while (last->previous) last = last->previous;
+      pushElementBatches(rest, last);
+    }
+
+    cache->elements = batch;
+    cache->count = batch->identifier;
+    batch->previous = NULL;
+    batch->identifier = 0;
+  }
 }
 
 static void
-removeElement (Element *element) {
-  element->queue->size -= 1;
-  element->queue = NULL;
-  element->identifier = 0;
+destroyElementCache (void *data) {
+  ElementCache *cache = data;
+
+  pthread_mutex_lock(&elementCachesMutex);
+    if (cache->next) cache->next->previous = cache->previous;
+
+    if (cache->previous) {
+      cache->previous->next = cache->next;
+    } else {
+      elementCaches = cache->next;
+    }
+
+    flushElementCache(cache);
+    cache->registered = 0;
+  pthread_mutex_unlock(&elementCachesMutex);
 }
 
 static void
-removeItem (Element *element) {
-  if (element->item) {
-    Queue *queue = element->queue;
-    ItemDeallocator *deallocateItem = queue->deallocateItem;
+createElementCacheKey (void) {
+  int error = pthread_key_create(&elementCacheKey, destroyElementCache);
 
-    if (deallocateItem) deallocateItem(element->item, queue->data);
-    element->item = NULL;
+  if (error) logActionError(error, "pthread_key_create");
+}
+
+static ElementCache *
+getElementCache (void) {
+  ElementCache *cache = &elementCache;
+
+  if (!cache->registered) {
+    /* so that the cache is returned to the pool when the thread exits */
+    pthread_once(&elementCacheOnce, createElementCacheKey);
+    pthread_setspecific(elementCacheKey, cache);
+
+    pthread_mutex_lock(&elementCachesMutex);
+      cache->previous = NULL;
+      if ((cache->next = elementCaches)) elementCaches->previous = cache;
+      elementCaches = cache;
+    pthread_mutex_unlock(&elementCachesMutex);
+
+    cache->registered = 1;
   }
+
+  return cache;
 }
 
 static void
-discardElement (Element *element) {
-  removeItem(element);
-  removeElement(element);
+cacheElement (Element *element) {
+  ElementCache *cache = getElementCache();
+
+  if (cache->count == QUEUE_ELEMENT_CACHE_LIMIT) flushElementCache(cache);
+  element->next = cache->elements;
+  cache->elements = element;
+  cache->count += 1;
+}
+
+static Element *
+retrieveElement (void) {
+  ElementCache *cache = getElementCache();
+  Element *element;
+
+  if (!cache->elements) refillElementCache(cache);
+
+  if ((element = cache->elements)) {
+    cache->elements = element->next;
+    cache->count -= 1;
+    element->next = NULL;
+  }
+
+  return element;
+}
+
+static void
+freeElements (void) {
+  Element *batch;
+
+  /* any thread still running mustn't be using queues by now */
+  pthread_mutex_lock(&elementCachesMutex);
+    for (ElementCache *cache=elementCaches; cache; cache=cache->next) {
+      flushElementCache(cache);
+    }
+  pthread_mutex_unlock(&elementCachesMutex);
+
+  batch = takeElementBatches();
+
+  while (batch) {
+    Element *next = batch->previous;
+
+    while (batch) {
+      Element *element = batch;
+      batch = element->next;
+      free(element);
+    }
 
+    batch = next;
+  }
+}
+
+static int
+newElementIdentifier (void) {
+  static unsigned int identifier = 0;
+  unsigned int old;
+  unsigned int new;
+
+  do {
+    old = identifier;
+    if (!(new = (old + 1) & INT_MAX)) new = 1;
+  } while (!__sync_bool_compare_and_swap(&identifier, old, new));
+
+  return new;
+}
+
+#else /* QUEUE_ELEMENT_POOLS */
+static Element *discardedElements = NULL;
+
+static LockDescriptor *
+getDiscardedElementsLock (void) {
+  static LockDescriptor *lock = NULL;
+
+  return getLockDescriptor(&lock, "queue-discarded-elements");
+}
+
+static void
+lockDiscardedElements (void) {
+  obtainExclusiveLock(getDiscardedElementsLock());
+}
+
+static void
+unlockDiscardedElements (void) {
+  releaseLock(getDiscardedElementsLock());
+}
+
+static void
+cacheElement (Element *element) {
   lockDiscardedElements();
     element->next = discardedElements;
     discardedElements = element;
@@ -112,6 +298,147 @@ retrieveElement (void) {
   return element;
 }
 
+static void
+freeElements (void) {
+  lockDiscardedElements();
+    while (discardedElements) {
+      Element *element = discardedElements;
+      discardedElements = element->next;
+      free(element);
+    }
+  unlockDiscardedElements();
+}
+
+static int
+newElementIdentifier (void) {
+  static int identifier = 0;
+  int new;
+
+  lockDiscardedElements();
+    if ((new = identifier + 1) == INT_MAX) new = 1;
+    identifier = new;
+  unlockDiscardedElements();
+
+  return new;
+}
+#endif /* QUEUE_ELEMENT_POOLS */
+
+static void
+addElement (Queue *queue, Element *element) {
+  element->identifier = newElementIdentifier();
+  element->queue = queue;
+  queue->size += 1;
+}
+
+#define QUEUE_INDEX_INITIAL_BITS 4
+
+static inline unsigned int
+getIndexBucket (const Queue *queue, ItemKey key) {
+  return (key * UINT64_C(0X9E3779B97F4A7C15)) >> (64 - queue->index.bits);
+}
+
+static void
+addIndexEntry (Queue *queue, Element *element) {
+  Element **bucket = &queue->index.buckets[getIndexBucket(queue, element->key)];
+
+  element->nextWithKey = *bucket;
+  *bucket = element;
+}
+
+static int
+resizeIndex (Queue *queue, unsigned char bits) {
+  Element **buckets = calloc((size_t)1 << bits, sizeof(*buckets));
+
+  if (!buckets) {
+    logMallocError();
+    return 0;
+  }
+
+  {
+    Element **oldBuckets = queue->index.buckets;
+    unsigned int oldCount = oldBuckets? (1U << queue->index.bits): 0;
+
+    queue->index.buckets = buckets;
+    queue->index.bits = bits;
+
+    for (unsigned int index=0; index<oldCount; index+=1) {
+      Element *element = oldBuckets[index];
+
+      while (element) {
+        Element *next = element->nextWithKey;
+        addIndexEntry(queue, element);
+        element = next;
+      }
+    }
+
+    if (oldBuckets) free(oldBuckets);
+  }
+
+  return 1;
+}
+
+static void
+indexElement (Element *element) {
+  Queue *queue = element->queue;
+
+  if (queue->index.makeKey) {
+    element->key = queue->index.makeKey(element->item, queue->data);
+
+    /* keep the chains short - a failure to grow only makes them longer */
+    if (queue->size > (2U << queue->index.bits)) {
+      if (queue->index.bits < 24) resizeIndex(queue, queue->index.bits+1);
+    }
+
+    addIndexEntry(queue, element);
+  }
+}
+
+static void
+unindexElement (Element *element) {
+  Queue *queue = element->queue;
+
+  if (queue->index.makeKey) {
+    Element **link = &queue->index.buckets[getIndexBucket(queue, element->key)];
+
+    while (*link) {
+      if (*link == element) {
+        *link = element->nextWithKey;
+        break;
+      }
+
+      link = &(*link)->nextWithKey;
+    }
+
+    element->nextWithKey = NULL;
+  }
+}
+
+static void
+removeElement (Element *element) {
+  unindexElement(element);
+  element->queue->size -= 1;
+  element->queue = NULL;
+  element->identifier = 0;
+}
+
+static void
+removeItem (Element *element) {
+  if (element->item) {
+    Queue *queue = element->queue;
+    ItemDeallocator *deallocateItem = queue->deallocateItem;
+
+    if (deallocateItem) deallocateItem(element->item, queue->data);
+    element->item = NULL;
+  }
+}
+
+static void
+discardElement (Element *element) {
+  removeItem(element);
+  removeElement(element);
+  cacheElement(element);
+}
+
 static Element *
 newElement (Queue *queue, void *item) {
   Element *element;
@@ -208,7 +535,11 @@ Element *
 enqueueItem (Queue *queue, void *item) {
   Element *element = newElement(queue, item);
 
-  if (element) linkElement(element);
+  if (element) {
+    indexElement(element);
+    linkElement(element);
+  }
+
   return element;
 }
 
@@ -223,6 +554,7 @@ moveElement (Element *element, Queue *queue) {
   unlinkElement(element);
   removeElement(element);
   addElement(queue, element);
+  indexElement(element);
   linkElement(element);
 }
 
@@ -258,14 +590,7 @@ static int queueInitialized = 0;
 
 static void
 exitQueue (void *data) {
-  lockDiscardedElements();
-    while (discardedElements) {
-      Element *element = discardedElements;
-      discardedElements = element->next;
-      free(element);
-    }
-  unlockDiscardedElements();
-
+  freeElements();
   queueInitialized = 0;
 }
 
@@ -284,6 +609,11 @@ newQueue (ItemDeallocator *deallocateItem, ItemComparator *compareItems) {
     queue->data = NULL;
     queue->deallocateItem = deallocateItem;
     queue->compareItems = compareItems;
+
+    queue->index.makeKey = NULL;
+    queue->index.buckets = NULL;
+    queue->index.bits = 0;
+
     return queue;
   } else {
     logMallocError();
@@ -300,9 +630,36 @@ deleteElements (Queue *queue) {
 void
 deallocateQueue (Queue *queue) {
   deleteElements(queue);
+  if (queue->index.buckets) free(queue->index.buckets);
   free(queue);
 }
 
+int
+setQueueKeyMaker (Queue *queue, ItemKeyMaker *makeKey) {
+  if (queue->index.buckets) {
+    free(queue->index.buckets);
+    queue->index.buckets = NULL;
+  }
+
+  queue->index.makeKey = NULL;
+
+  if (makeKey) {
+    if (!resizeIndex(queue, QUEUE_INDEX_INITIAL_BITS)) return 0;
+    queue->index.makeKey = makeKey;
+
+    if (queue->head) {
+      Element *element = queue->head;
+
+      do {
+        element->key = makeKey(element->item, queue->data);
+        addIndexEntry(queue, element);
+      } while ((element = element->next) != queue->head);
+    }
+  }
+
+  return 1;
+}
+
 static void
 exitProgramQueue (void *data) {
   Queue **queue = data;
@@ -416,8 +773,39 @@ testElementHasItem (const void *item, void *data) {
   return item == data;
 }
 
+Element *
+findElementWithKey (const Queue *queue, ItemKey key, ItemTester *testItem, void *data) {
+  if (!queue->index.makeKey) return findElement(queue, testItem, data);
+
+  {
+    Element *element = queue->index.buckets[getIndexBucket(queue, key)];
+
+    while (element) {
+      if (element->key == key) {
+        if (testItem(element->item, data)) return element;
+      }
+
+      element = element->nextWithKey;
+    }
+  }
+
+  return NULL;
+}
+
+void *
+findItemWithKey (const Queue *queue, ItemKey key, ItemTester *testItem, void *data) {
+  Element *element = findElementWithKey(queue, key, testItem, data);
+  if (element) return element->item;
+  return NULL;
+}
+
 Element *
 findElementWithItem (const Queue *queue, void *item) {
+  if (queue->index.makeKey) {
+    ItemKey key = queue->index.makeKey(item, queue->data);
+    return findElementWithKey(queue, key, testElementHasItem, item);
+  }
+
   return findElement(queue, testElementHasItem, item);
 }
 
@@ -433,14 +821,9 @@ processQueue (Queue *queue, ItemProcessor *processItem, void *data) {
   return NULL;
 }
 
-static int
-testItemAddress (const void *item, void *data) {
-  return item == data;
-}
-
 int
 deleteItem (Queue *queue, void *item) {
-  Element *element = findElement(queue, testItemAddress, item);
+  Element *element = findElementWithItem(queue, item);
   if (!element) return 0;
 
   element->item = NULL;
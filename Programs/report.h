@@ -28,6 +28,7 @@ extern "C" {
 typedef enum {
   REPORT_BRAILLE_DEVICE_ONLINE,
   REPORT_BRAILLE_DEVICE_OFFLINE,
+  REPORT_BRAILLE_OUTPUT_READY,
   REPORT_BRAILLE_WINDOW_MOVED,
   REPORT_BRAILLE_WINDOW_UPDATED,
   REPORT_BRAILLE_KEY_EVENT,
@@ -19,67 +19,42 @@
 #include "prologue.h"
 
 #include <stdio.h>
-#include <stdarg.h>
 #include <string.h>
-#include <errno.h>
-
-#ifdef HAVE_SIGNAL_H
-#include <signal.h>
-#endif /* HAVE_SIGNAL_H */
-
-#ifdef SIGUSR1
-#include <sys/wait.h>
-#endif /* SIGUSR1 */
 
 #include "parameters.h"
 #include "log.h"
 #include "program.h"
-#include "thread.h"
+#include "async_alarm.h"
 #include "async_wait.h"
 #include "timing.h"
 #include "scr.h"
 #include "routing.h"
 
+/* Cursor routing runs on the core's event loop. Each step sends cursor
+ * motion keys to the main screen and then, rather than sleeping, waits to
+ * be woken by the screen driver's update notifications (the vcsa monitor,
+ * AT-SPI caret events, etc) - it only polls if the driver can't monitor
+ * for updates. A step is over once the cursor has stopped moving.
+ *
+ * A single key can move the cursor across several columns (tabs, wide
+ * characters), so keys are only batched along the target row, and as soon
+ * as a batch doesn't land the cursor exactly where it should have the rest
+ * of the route is done (and verified) one key at a time.
+ */
+
 typedef enum {
   CRR_DONE,
   CRR_NEAR,
   CRR_FAIL
 } RoutingResult;
 
-typedef struct {
-#ifdef SIGUSR1
-  struct {
-    sigset_t mask;
-  } signal;
-#endif /* SIGUSR1 */
-
-  struct {
-    int number;
-    int width;
-    int height;
-  } screen;
-
-  struct {
-    int scroll;
-    int row;
-    ScreenCharacter *buffer;
-  } vertical;
-
-  struct {
-    int column;
-    int row;
-  } current;
-
-  struct {
-    int column;
-    int row;
-  } previous;
-
-  struct {
-    long sum;
-    int count;
-  } time;
-} CursorRoutingData;
+typedef enum {
+  CRP_ROW,         /* to the target row (or the nearest one above it) */
+  CRP_COLUMN,      /* along it to the target column */
+  CRP_NEXT_ROW,    /* the column may be on the row's continuation */
+  CRP_NEXT_COLUMN, /* along the continuation to the target column */
+  CRP_ROW_ONLY     /* to the target row when there's no target column */
+} RoutingPhase;
 
 typedef enum {
   CURSOR_DIR_LEFT,
@@ -122,12 +97,86 @@ static const CursorAxisEntry cursorAxisTable[] = {
   }
 };
 
+typedef struct {
+  int column;
+  int row;
+  int screen;
+} RoutingParameters;
+
+typedef struct {
+  RoutingParameters parameters;
+  RoutingPhase phase;
+  unsigned batch:1;
+
+  struct {
+    int number;
+    int width;
+    int height;
+
+    unsigned monitor:1;
+  } screen;
+
+  struct {
+    int scroll;
+    int row;
+    ScreenCharacter *buffer;
+  } vertical;
+
+  struct {
+    int column;
+    int row;
+  } current;
+
+  struct {
+    int column;
+    int row;
+  } previous;
+
+  struct {
+    long sum;
+    int count;
+  } time;
+
+  struct {
+    const CursorAxisEntry *axis;
+    int where;
+    int row;
+    int column;
+
+    int dify;
+    int difx;
+    int direction;
+    unsigned int keys;
+    unsigned returning:1;
+  } adjustment;
+
+  struct {
+    AsyncHandle alarm;
+    AsyncHandle poll;
+    TimeValue start;
+    long int timeout;
+    unsigned moved:1;
+  } motion;
+
+  struct {
+    TimeValue start;
+    unsigned int keys;
+    unsigned int batches;
+    unsigned int reads;
+    unsigned int updates;
+  } statistics;
+} CursorRoutingData;
+
+static CursorRoutingData *routingData = NULL;
+static RoutingStatus routingStatus = ROUTING_STATUS_NONE;
+
 #define logRouting(...) logMessage(LOG_CATEGORY(CURSOR_ROUTING), __VA_ARGS__)
 
 static int
 readRow (CursorRoutingData *crd, ScreenCharacter *buffer, int row) {
   if (!buffer) buffer = crd->vertical.buffer;
-  if (readScreenRow(row, crd->screen.width, buffer)) return 1;
+  crd->statistics.reads += 1;
+  if (readRoutingScreenRow(row, crd->screen.width, buffer)) return 1;
   logRouting("read failed: row=%d", row);
   return 0;
 }
@@ -135,7 +184,8 @@ readRow (CursorRoutingData *crd, ScreenCharacter *buffer, int row) {
 static int
 getCurrentPosition (CursorRoutingData *crd) {
   ScreenDescription description;
-  describeScreen(&description);
+  describeRoutingScreen(&description);
+  crd->statistics.reads += 1;
 
   if (description.number != crd->screen.number) {
     logRouting("screen changed: %d -> %d", crd->screen.number, description.number);
@@ -214,360 +264,477 @@ handleVerticalScrolling (CursorRoutingData *crd, int direction) {
   crd->current.row -= delta;
 }
 
-static int
-awaitCursorMotion (CursorRoutingData *crd, int direction) {
-  crd->previous.column = crd->current.column;
-  crd->previous.row = crd->current.row;
+static void
+stopCursorMotion (CursorRoutingData *crd) {
+  if (crd->motion.alarm) {
+    asyncCancelRequest(crd->motion.alarm);
+    crd->motion.alarm = NULL;
+  }
+
+  if (crd->motion.poll) {
+    asyncCancelRequest(crd->motion.poll);
+    crd->motion.poll = NULL;
+  }
+}
+
+static void
+endRouting (CursorRoutingData *crd, RoutingStatus status) {
+  stopCursorMotion(crd);
+  setRoutingScreenUpdatedHandler(NULL, NULL);
 
-  TimeValue start;
-  getMonotonicTime(&start);
+  logRouting("statistics: time=%ldms keys=%u batches=%u reads=%u updates=%u status=%u",
+             getMonotonicElapsed(&crd->statistics.start),
+             crd->statistics.keys, crd->statistics.batches,
+             crd->statistics.reads, crd->statistics.updates,
+             status);
 
-  int moved = 0;
-  long int timeout = crd->time.sum / crd->time.count;
+  if (crd->vertical.buffer) free(crd->vertical.buffer);
+  free(crd);
 
-  while (1) {
-    asyncWait(ROUTING_POLL_INTERVAL);
+  routingData = NULL;
+  routingStatus = status;
+}
+
+static void
+finishRouting (CursorRoutingData *crd) {
+  const RoutingParameters *parameters = &crd->parameters;
+  RoutingStatus status;
+
+  if (crd->screen.number != parameters->screen) {
+    status = ROUTING_STATUS_FAILURE;
+  } else if (crd->current.row != parameters->row) {
+    status = ROUTING_STATUS_ROW;
+  } else if ((parameters->column >= 0) && (crd->current.column != parameters->column)) {
+    status = ROUTING_STATUS_COLUMN;
+  } else {
+    status = ROUTING_STATUS_SUCCEESS;
+  }
 
+  endRouting(crd, status);
+}
+
+static void continueRouting (CursorRoutingData *crd, RoutingResult result);
+static void evaluateCursorMotion (CursorRoutingData *crd);
+
+ASYNC_ALARM_CALLBACK(handleCursorMotionTimeout);
+
+static void
+setCursorMotionAlarm (CursorRoutingData *crd, long int timeout) {
+  if (crd->motion.alarm) {
+    asyncResetAlarmIn(crd->motion.alarm, timeout);
+  } else {
+    asyncNewRelativeAlarm(&crd->motion.alarm, timeout,
+                          handleCursorMotionTimeout, crd);
+  }
+}
+
+static int
+checkCursorMotion (CursorRoutingData *crd) {
+  int oldy = crd->current.row;
+  int oldx = crd->current.column;
+
+  if (!crd->screen.monitor) pollRoutingScreen();
+  refreshRoutingScreen();
+  if (!getCurrentPosition(crd)) return 0;
+
+  if ((crd->current.row != oldy) || (crd->current.column != oldx)) {
     TimeValue now;
     getMonotonicTime(&now);
-    long int time = millisecondsBetween(&start, &now) + 1;
+    long int time = millisecondsBetween(&crd->motion.start, &now) + 1;
 
-    int oldy = crd->current.row;
-    int oldx = crd->current.column;
-    if (!getCurrentPosition(crd)) return 0;
+    logRouting("moved: [%d,%d] -> [%d,%d] (%ldms)",
+               oldx, oldy, crd->current.column, crd->current.row, time);
 
-    if ((crd->current.row != oldy) || (crd->current.column != oldx)) {
-      logRouting("moved: [%d,%d] -> [%d,%d] (%ldms)",
-                 oldx, oldy, crd->current.column, crd->current.row, time);
+    if (!crd->motion.moved) {
+      crd->motion.moved = 1;
+      crd->motion.timeout = (time * 2) + 1;
 
-      if (!moved) {
-        moved = 1;
-        timeout = (time * 2) + 1;
+      crd->time.sum += time * 8;
+      crd->time.count += 1;
+    }
 
-        crd->time.sum += time * 8;
-        crd->time.count += 1;
-      }
+    /* wait for it to stop moving */
+    crd->motion.start = now;
+    setCursorMotionAlarm(crd, crd->motion.timeout);
+  }
 
-      if (ROUTING_POLL_INTERVAL) {
-        start = now;
-      } else {
-        asyncWait(1);
-        getMonotonicTime(&start);
+  return 1;
+}
+
+ASYNC_ALARM_CALLBACK(handleCursorMotionPoll) {
+  CursorRoutingData *crd = parameters->data;
+
+  if (!checkCursorMotion(crd)) continueRouting(crd, CRR_FAIL);
+}
+
+static void
+monitorCursorMotion (CursorRoutingData *crd) {
+  if (crd->screen.monitor) {
+    if (!pollRoutingScreen()) return;
+
+    logRouting("screen monitoring unavailable - polling");
+    crd->screen.monitor = 0;
+  }
+
+  if (!crd->motion.poll) {
+    if (asyncNewRelativeAlarm(&crd->motion.poll, ROUTING_POLL_INTERVAL,
+                              handleCursorMotionPoll, crd)) {
+      if (!asyncResetAlarmInterval(crd->motion.poll, ROUTING_POLL_INTERVAL)) {
+        asyncCancelRequest(crd->motion.poll);
+        crd->motion.poll = NULL;
       }
-    } else if (time > timeout) {
-      break;
     }
   }
+}
 
-  handleVerticalScrolling(crd, direction);
-  return 1;
+static void
+handleScreenUpdated (void *data) {
+  CursorRoutingData *crd = data;
+
+  crd->statistics.updates += 1;
+
+  if (!checkCursorMotion(crd)) {
+    continueRouting(crd, CRR_FAIL);
+  } else {
+    monitorCursorMotion(crd);
+  }
+}
+
+ASYNC_ALARM_CALLBACK(handleCursorMotionTimeout) {
+  CursorRoutingData *crd = parameters->data;
+
+  asyncDiscardHandle(crd->motion.alarm);
+  crd->motion.alarm = NULL;
+
+  if (!checkCursorMotion(crd)) {
+    continueRouting(crd, CRR_FAIL);
+    return;
+  }
+
+  /* it's still moving */
+  if (crd->motion.alarm) return;
+
+  if (crd->motion.poll) {
+    asyncCancelRequest(crd->motion.poll);
+    crd->motion.poll = NULL;
+  }
+
+  handleVerticalScrolling(crd, crd->adjustment.direction);
+  evaluateCursorMotion(crd);
 }
 
 static int
-moveCursor (CursorRoutingData *crd, const CursorDirectionEntry *direction) {
+sendCursorKeys (CursorRoutingData *crd, const CursorDirectionEntry *direction, unsigned int count) {
   crd->vertical.row = crd->current.row - crd->vertical.scroll;
   if (!readRow(crd, NULL, crd->vertical.row)) return 0;
 
-#ifdef SIGUSR1
-  sigset_t oldMask;
-  sigprocmask(SIG_BLOCK, &crd->signal.mask, &oldMask);
-#endif /* SIGUSR1 */
+  logRouting("move: %s x%u", direction->name, count);
+  crd->adjustment.keys = count;
+  crd->statistics.keys += count;
+  if (count > 1) crd->statistics.batches += 1;
+  while (count--) insertRoutingScreenKey(direction->key);
 
-  logRouting("move: %s", direction->name);
-  insertScreenKey(direction->key);
+  crd->previous.column = crd->current.column;
+  crd->previous.row = crd->current.row;
 
-#ifdef SIGUSR1
-  sigprocmask(SIG_SETMASK, &oldMask, NULL);
-#endif /* SIGUSR1 */
+  getMonotonicTime(&crd->motion.start);
+  crd->motion.moved = 0;
+  crd->motion.timeout = crd->time.sum / crd->time.count;
+  setCursorMotionAlarm(crd, crd->motion.timeout);
+  monitorCursorMotion(crd);
 
   return 1;
 }
 
-static RoutingResult
-adjustCursorPosition (CursorRoutingData *crd, int where, int trgy, int trgx, const CursorAxisEntry *axis) {
-  logRouting("to: [%d,%d]", trgx, trgy);
-
-  while (1) {
-    int dify = trgy - crd->current.row;
-    int difx = (trgx < 0)? 0: (trgx - crd->current.column);
-    int dir;
+static unsigned int
+getCursorKeyCount (CursorRoutingData *crd) {
+  if (crd->batch) {
+    if (crd->adjustment.axis == &cursorAxisTable[CURSOR_AXIS_HORIZONTAL]) {
+      if (!crd->adjustment.dify) {
+        int count = crd->adjustment.difx * crd->adjustment.direction;
 
-    /* determine which direction the cursor needs to move in */
-    if (dify) {
-      dir = (dify > 0)? 1: -1;
-    } else if (difx) {
-      dir = (difx > 0)? 1: -1;
-    } else {
-      return CRR_DONE;
+        if (count > ROUTING_KEY_BATCH_LIMIT) count = ROUTING_KEY_BATCH_LIMIT;
+        return count;
+      }
     }
+  }
 
-    /* tell the cursor to move in the needed direction */
-    if (!moveCursor(crd, ((dir > 0)? axis->forward: axis->backward))) return CRR_FAIL;
-    if (!awaitCursorMotion(crd, dir)) return CRR_FAIL;
-
-    if (crd->current.row != crd->previous.row) {
-      if (crd->previous.row != trgy) {
-        if (((crd->current.row - crd->previous.row) * dir) > 0) {
-          int dif = trgy - crd->current.row;
-          if ((dif * dify) >= 0) continue;
-          if (where > 0) {
-            if (crd->current.row > trgy) return CRR_NEAR;
-          } else if (where < 0) {
-            if (crd->current.row < trgy) return CRR_NEAR;
-          } else {
-            if ((dif * dif) < (dify * dify)) return CRR_NEAR;
-          }
-        }
-      }
-    } else if (crd->current.column != crd->previous.column) {
-      if (((crd->current.column - crd->previous.column) * dir) > 0) {
-        int dif = trgx - crd->current.column;
-        if (crd->current.row != trgy) continue;
-        if ((dif * difx) >= 0) continue;
+  return 1;
+}
+
+static void
+stepCursorAdjustment (CursorRoutingData *crd) {
+  int trgy = crd->adjustment.row;
+  int trgx = crd->adjustment.column;
+
+  int dify = trgy - crd->current.row;
+  int difx = (trgx < 0)? 0: (trgx - crd->current.column);
+  int dir;
+
+  /* determine which direction the cursor needs to move in */
+  if (dify) {
+    dir = (dify > 0)? 1: -1;
+  } else if (difx) {
+    dir = (difx > 0)? 1: -1;
+  } else {
+    continueRouting(crd, CRR_DONE);
+    return;
+  }
+
+  crd->adjustment.dify = dify;
+  crd->adjustment.difx = difx;
+  crd->adjustment.direction = dir;
+
+  /* tell the cursor to move in the needed direction */
+  const CursorAxisEntry *axis = crd->adjustment.axis;
+  const CursorDirectionEntry *direction = (dir > 0)? axis->forward: axis->backward;
+
+  if (!sendCursorKeys(crd, direction, getCursorKeyCount(crd))) {
+    continueRouting(crd, CRR_FAIL);
+  }
+}
+
+typedef enum {
+  CMV_CLOSER,
+  CMV_NEAREST,
+  CMV_FARTHER
+} CursorMotionVerdict;
+
+static CursorMotionVerdict
+judgeCursorMotion (CursorRoutingData *crd) {
+  int where = crd->adjustment.where;
+  int trgy = crd->adjustment.row;
+  int trgx = crd->adjustment.column;
+  int dify = crd->adjustment.dify;
+  int difx = crd->adjustment.difx;
+  int dir = crd->adjustment.direction;
+
+  if (crd->current.row != crd->previous.row) {
+    if (crd->previous.row != trgy) {
+      if (((crd->current.row - crd->previous.row) * dir) > 0) {
+        int dif = trgy - crd->current.row;
+        if ((dif * dify) >= 0) return CMV_CLOSER;
         if (where > 0) {
-          if (crd->current.column > trgx) return CRR_NEAR;
+          if (crd->current.row > trgy) return CMV_NEAREST;
         } else if (where < 0) {
-          if (crd->current.column < trgx) return CRR_NEAR;
+          if (crd->current.row < trgy) return CMV_NEAREST;
         } else {
-          if ((dif * dif) < (difx * difx)) return CRR_NEAR;
+          if ((dif * dif) < (dify * dify)) return CMV_NEAREST;
         }
       }
-    } else {
-      return CRR_NEAR;
     }
-
-    /* We're getting farther from our target. Before giving up, let's
-     * try going back to the previous position since it was obviously
-     * the nearest ever reached.
-     */
-    if (!moveCursor(crd, ((dir > 0)? axis->backward: axis->forward))) return CRR_FAIL;
-    return awaitCursorMotion(crd, -dir)? CRR_NEAR: CRR_FAIL;
+  } else if (crd->current.column != crd->previous.column) {
+    if (((crd->current.column - crd->previous.column) * dir) > 0) {
+      int dif = trgx - crd->current.column;
+      if (crd->current.row != trgy) return CMV_CLOSER;
+      if ((dif * difx) >= 0) return CMV_CLOSER;
+      if (where > 0) {
+        if (crd->current.column > trgx) return CMV_NEAREST;
+      } else if (where < 0) {
+        if (crd->current.column < trgx) return CMV_NEAREST;
+      } else {
+        if ((dif * dif) < (difx * difx)) return CMV_NEAREST;
+      }
+    }
+  } else {
+    return CMV_NEAREST;
   }
-}
 
-static RoutingResult
-adjustCursorHorizontally (CursorRoutingData *crd, int where, int row, int column) {
-  return adjustCursorPosition(crd, where, row, column, &cursorAxisTable[CURSOR_AXIS_HORIZONTAL]);
-}
-
-static RoutingResult
-adjustCursorVertically (CursorRoutingData *crd, int where, int row) {
-  return adjustCursorPosition(crd, where, row, -1, &cursorAxisTable[CURSOR_AXIS_VERTICAL]);
+  return CMV_FARTHER;
 }
 
-typedef struct {
-  int column;
-  int row;
-  int screen;
-} RoutingParameters;
-
-static RoutingStatus
-routeCursor (const RoutingParameters *parameters) {
-  CursorRoutingData crd;
-
-#ifdef SIGUSR1
-  /* Set up the signal mask. */
-  sigemptyset(&crd.signal.mask);
-  sigaddset(&crd.signal.mask, SIGUSR1);
-  sigprocmask(SIG_UNBLOCK, &crd.signal.mask, NULL);
-#endif /* SIGUSR1 */
+static void
+evaluateCursorMotion (CursorRoutingData *crd) {
+  if (crd->adjustment.returning) {
+    continueRouting(crd, CRR_NEAR);
+    return;
+  }
 
-  /* initialize the routing data structure */
-  crd.screen.number = parameters->screen;
-  crd.vertical.buffer = NULL;
-  crd.time.sum = ROUTING_MAXIMUM_TIMEOUT;
-  crd.time.count = 1;
+  if (crd->adjustment.keys > 1) {
+    int expected = crd->previous.column + (crd->adjustment.keys * crd->adjustment.direction);
 
-  if (getCurrentPosition(&crd)) {
-    logRouting("from: [%d,%d]", crd.current.column, crd.current.row);
+    if ((crd->current.row != crd->previous.row) || (crd->current.column != expected)) {
+      logRouting("batch landed at [%d,%d] - moving one key at a time",
+                 crd->current.column, crd->current.row);
+      crd->batch = 0;
 
-    if (parameters->column < 0) {
-      adjustCursorVertically(&crd, 0, parameters->row);
-    } else {
-      if (adjustCursorVertically(&crd, -1, parameters->row) != CRR_FAIL) {
-        if (adjustCursorHorizontally(&crd, 0, parameters->row, parameters->column) == CRR_NEAR) {
-          if (crd.current.row < parameters->row) {
-            if (adjustCursorVertically(&crd, 1, crd.current.row+1) != CRR_FAIL) {
-              adjustCursorHorizontally(&crd, 0, parameters->row, parameters->column);
-            }
-          }
-        }
+      if ((crd->current.row != crd->previous.row) ||
+          (crd->current.column != crd->previous.column)) {
+        stepCursorAdjustment(crd);
+        return;
       }
     }
   }
 
-  if (crd.vertical.buffer) free(crd.vertical.buffer);
+  switch (judgeCursorMotion(crd)) {
+    case CMV_CLOSER:
+      stepCursorAdjustment(crd);
+      return;
 
-  if (crd.screen.number != parameters->screen) return ROUTING_STATUS_FAILURE;
-  if (crd.current.row != parameters->row) return ROUTING_STATUS_ROW;
-  if ((parameters->column >= 0) && (crd.current.column != parameters->column)) return ROUTING_STATUS_COLUMN;
-  return ROUTING_STATUS_SUCCEESS;
-}
+    case CMV_NEAREST:
+      continueRouting(crd, CRR_NEAR);
+      return;
 
-#ifdef SIGUSR1
-#define NOT_ROUTING 0
+    case CMV_FARTHER:
+      break;
+  }
 
-static pid_t routingProcess = NOT_ROUTING;
+  /* We're getting farther from our target. Before giving up, let's
+   * try going back to the previous position since it was obviously
+   * the nearest ever reached.
+   */
+  const CursorAxisEntry *axis = crd->adjustment.axis;
+  int dir = crd->adjustment.direction;
 
-int
-isRouting (void) {
-  return routingProcess != NOT_ROUTING;
+  crd->adjustment.returning = 1;
+  crd->adjustment.direction = -dir;
+
+  if (!sendCursorKeys(crd, ((dir > 0)? axis->backward: axis->forward), 1)) {
+    continueRouting(crd, CRR_FAIL);
+  }
 }
 
-RoutingStatus
-getRoutingStatus (int wait) {
-  if (isRouting()) {
-    int options = 0;
-    if (!wait) options |= WNOHANG;
+static void
+adjustCursorPosition (CursorRoutingData *crd, int where, int trgy, int trgx, const CursorAxisEntry *axis) {
+  logRouting("to: [%d,%d]", trgx, trgy);
 
-  doWait:
-    {
-      int status;
-      pid_t process = waitpid(routingProcess, &status, options);
+  crd->adjustment.axis = axis;
+  crd->adjustment.where = where;
+  crd->adjustment.row = trgy;
+  crd->adjustment.column = trgx;
+  crd->adjustment.returning = 0;
 
-      if (process == routingProcess) {
-        routingProcess = NOT_ROUTING;
-        return WIFEXITED(status)? WEXITSTATUS(status): ROUTING_STATUS_FAILURE;
-      }
+  stepCursorAdjustment(crd);
+}
 
-      if (process == -1) {
-        if (errno == EINTR) goto doWait;
+static void
+adjustCursorHorizontally (CursorRoutingData *crd, int where, int row, int column) {
+  adjustCursorPosition(crd, where, row, column, &cursorAxisTable[CURSOR_AXIS_HORIZONTAL]);
+}
 
-        if (errno == ECHILD) {
-          routingProcess = NOT_ROUTING;
-          return ROUTING_STATUS_FAILURE;
-        }
+static void
+adjustCursorVertically (CursorRoutingData *crd, int where, int row) {
+  adjustCursorPosition(crd, where, row, -1, &cursorAxisTable[CURSOR_AXIS_VERTICAL]);
+}
 
-        logSystemError("waitpid");
-      }
-    }
+static void
+continueRouting (CursorRoutingData *crd, RoutingResult result) {
+  const RoutingParameters *parameters = &crd->parameters;
+
+  switch (crd->phase) {
+    case CRP_ROW:
+      if (result == CRR_FAIL) break;
+      crd->phase = CRP_COLUMN;
+      adjustCursorHorizontally(crd, 0, parameters->row, parameters->column);
+      return;
+
+    case CRP_COLUMN:
+      if (result != CRR_NEAR) break;
+      if (crd->current.row >= parameters->row) break;
+      crd->phase = CRP_NEXT_ROW;
+      adjustCursorVertically(crd, 1, crd->current.row+1);
+      return;
+
+    case CRP_NEXT_ROW:
+      if (result == CRR_FAIL) break;
+      crd->phase = CRP_NEXT_COLUMN;
+      adjustCursorHorizontally(crd, 0, parameters->row, parameters->column);
+      return;
+
+    case CRP_NEXT_COLUMN:
+    case CRP_ROW_ONLY:
+    default:
+      break;
   }
 
-  return ROUTING_STATUS_NONE;
+  finishRouting(crd);
 }
 
-static void
-stopRouting (void) {
-  if (isRouting()) {
-    kill(routingProcess, SIGUSR1);
-    getRoutingStatus(1);
-  }
+int
+isRouting (void) {
+  return !!routingData;
 }
 
-static void
-exitCursorRouting (void *data) {
-  stopRouting();
+ASYNC_CONDITION_TESTER(testRoutingStopped) {
+  return !isRouting();
 }
-#else /* SIGUSR1 */
-static RoutingStatus routingStatus = ROUTING_STATUS_NONE;
 
 RoutingStatus
 getRoutingStatus (int wait) {
+  if (wait) asyncWaitFor(testRoutingStopped, NULL);
+
   RoutingStatus status = routingStatus;
   routingStatus = ROUTING_STATUS_NONE;
   return status;
 }
 
-int
-isRouting (void) {
-  return 0;
+static void
+stopRouting (void) {
+  if (isRouting()) {
+    logRouting("stopped");
+    endRouting(routingData, ROUTING_STATUS_NONE);
+  }
 }
-#endif /* SIGUSR1 */
-
-static int
-startRoutingProcess (const RoutingParameters *parameters) {
-#ifdef SIGUSR1
-  int started = 0;
 
+static void
+exitCursorRouting (void *data) {
   stopRouting();
+}
 
-  switch (routingProcess = fork()) {
-    case 0: { /* child: cursor routing subprocess */
-      RoutingStatus status = ROUTING_STATUS_FAILURE;
-
-      if (!ROUTING_POLL_INTERVAL) {
-        int niceness = nice(ROUTING_PROCESS_NICENESS);
-
-        if (niceness == -1) {
-          logSystemError("nice");
-        }
-      }
+int
+startRouting (int column, int row, int screen) {
+  CursorRoutingData *crd;
 
-      if (constructRoutingScreen()) {
-        status = routeCursor(parameters);		/* terminate child process */
-        destructRoutingScreen();		/* close second thread of screen reading */
-      }
+  stopRouting();
+  routingStatus = ROUTING_STATUS_NONE;
 
-      _exit(status);		/* terminate child process */
-    }
+  if (!(crd = malloc(sizeof(*crd)))) {
+    logMallocError();
+    return 0;
+  }
 
-    case -1: /* error: fork() failed */
-      logSystemError("fork");
-      routingProcess = NOT_ROUTING;
-      break;
+  memset(crd, 0, sizeof(*crd));
+  crd->parameters.column = column;
+  crd->parameters.row = row;
+  crd->parameters.screen = screen;
 
-    default: {
-      /* parent: continue while cursor is being routed */
+  crd->screen.number = screen;
+  crd->screen.monitor = 1;
+  crd->vertical.buffer = NULL;
+  crd->time.sum = ROUTING_MAXIMUM_TIMEOUT;
+  crd->time.count = 1;
+  crd->batch = 1;
 
-      {
-        static int first = 1;
+  crd->motion.alarm = NULL;
+  crd->motion.poll = NULL;
+  getMonotonicTime(&crd->statistics.start);
 
-        if (first) {
-          first = 0;
-          onProgramExit("cursor-routing", exitCursorRouting, NULL);
-        }
-      }
+  {
+    static int first = 1;
 
-      started = 1;
-      break;
+    if (first) {
+      first = 0;
+      onProgramExit("cursor-routing", exitCursorRouting, NULL);
     }
   }
 
-  return started;
-#else /* SIGUSR1 */
-  routingStatus = routeCursor(parameters);
-  return 1;
-#endif /* SIGUSR1 */
-}
-
-#ifdef GOT_PTHREADS
-typedef struct {
-  const RoutingParameters *const parameters;
-
-  int result;
-} RoutingThreadArgument;
+  routingData = crd;
+  setRoutingScreenUpdatedHandler(handleScreenUpdated, crd);
+  refreshRoutingScreen();
 
-THREAD_FUNCTION(runRoutingThread) {
-  RoutingThreadArgument *rta = argument;
-
-  rta->result = startRoutingProcess(rta->parameters);
-  return NULL;
-}
-#endif /* GOT_PTHREADS */
+  if (getCurrentPosition(crd)) {
+    logRouting("from: [%d,%d]", crd->current.column, crd->current.row);
 
-int
-startRouting (int column, int row, int screen) {
-  const RoutingParameters parameters = {
-    .column = column,
-    .row = row,
-    .screen = screen
-  };
-
-#ifdef GOT_PTHREADS
-  int started = 0;
-
-  RoutingThreadArgument rta = {
-    .parameters = &parameters
-  };
-
-  if (callThreadFunction("cursor-routing", runRoutingThread, &rta, NULL)) {
-    if (rta.result) {
-      started = 1;
+    if (column < 0) {
+      crd->phase = CRP_ROW_ONLY;
+      adjustCursorVertically(crd, 0, row);
+    } else {
+      crd->phase = CRP_ROW;
+      adjustCursorVertically(crd, -1, row);
     }
+  } else {
+    finishRouting(crd);
   }
 
-  return started;
-#else /* GOT_PTHREADS */
-  return startRoutingProcess(&parameters);
-#endif /* GOT_PTHREADS */
+  return 1;
 }
@@ -0,0 +1,460 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* rqstest checks BrlAPI's pipelined requests against a loopback server */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+
+#define BRLAPI_NO_DEPRECATED
+#include "brlapi.h"
+#include "brlapi_protocol.h"
+
+static char *opt_requestCount;
+static char *opt_serverLatency;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "count",
+    .letter = 'c',
+    .argument = "requests",
+    .setting.string = &opt_requestCount,
+    .internal.setting = "200",
+    .description = "how many requests to send in each test"
+  },
+
+  { .word = "latency",
+    .letter = 'l',
+    .argument = "msecs",
+    .setting.string = &opt_serverLatency,
+    .internal.setting = "1",
+    .description = "how long the server takes to acknowledge a request"
+  },
+END_OPTION_TABLE
+
+static int requestCount;
+static int serverLatency;
+
+static int
+validateOptions (void) {
+  {
+    static const int minimum = 2;
+
+    if (!validateInteger(&requestCount, opt_requestCount, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid request count: %s", opt_requestCount);
+      return 0;
+    }
+  }
+
+  {
+    static const int minimum = 1;
+
+    if (!validateInteger(&serverLatency, opt_serverLatency, &minimum, NULL)) {
+      logMessage(LOG_ERR, "invalid server latency: %s", opt_serverLatency);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/* The loopback server acknowledges each request serverLatency milliseconds
+ * after receiving it, whether or not earlier acknowledgements are still
+ * outstanding, so the cost of a round trip is the same as it would be over
+ * a slow link. Setting the read-only server version parameter fails.
+ */
+#define REPLY_QUEUE_SIZE 0X400
+
+typedef struct {
+  TimeValue due;
+  uint32_t error;
+  brlapi_packetType_t type;
+} ServerReply;
+
+typedef struct {
+  int listener;
+  unsigned int port;
+
+  /* for the next connection: close it after this many requests (0 = never) */
+  unsigned int closeAfter;
+} LoopbackServer;
+
+static int
+sendServerReply (int fd, const ServerReply *reply) {
+  if (reply->error) {
+    brlapi_errorPacket_t packet = {
+      .code = htonl(reply->error),
+      .type = htonl(reply->type)
+    };
+
+    return brlapi_writePacket(fd, BRLAPI_PACKET_ERROR, &packet,
+                              sizeof(packet.code) + sizeof(packet.type)) >= 0;
+  }
+
+  return brlapi_writePacket(fd, BRLAPI_PACKET_ACK, NULL, 0) >= 0;
+}
+
+static int
+beginServerSession (int fd) {
+  brlapi_packet_t packet;
+  brlapi_packetType_t type;
+
+  packet.version.protocolVersion = htonl(BRLAPI_PROTOCOL_VERSION);
+  if (brlapi_writePacket(fd, BRLAPI_PACKET_VERSION, &packet.version, sizeof(packet.version)) < 0) return 0;
+  if (brlapi_readPacket(fd, &type, &packet, sizeof(packet)) < 0) return 0;
+  if (type != BRLAPI_PACKET_VERSION) return 0;
+
+  packet.authServer.type[0] = htonl(BRLAPI_AUTH_NONE);
+  if (brlapi_writePacket(fd, BRLAPI_PACKET_AUTH, &packet.authServer, sizeof(packet.authServer)) < 0) return 0;
+  return 1;
+}
+
+static void
+serveConnection (int fd, unsigned int closeAfter) {
+  static ServerReply replies[REPLY_QUEUE_SIZE];
+  unsigned int first = 0;
+  unsigned int count = 0;
+  unsigned int received = 0;
+
+  if (!beginServerSession(fd)) return;
+
+  while (1) {
+    int timeout = -1;
+
+    if (count) {
+      TimeValue now;
+      getMonotonicTime(&now);
+
+      if (compareTimeValues(&now, &replies[first].due) >= 0) {
+        if (!sendServerReply(fd, &replies[first])) return;
+        first = (first + 1) % REPLY_QUEUE_SIZE;
+        count -= 1;
+        continue;
+      }
+
+      timeout = millisecondsBetween(&now, &replies[first].due) + 1;
+    }
+
+    struct pollfd pfd = {.fd=fd, .events=POLLIN};
+    int result = poll(&pfd, 1, timeout);
+
+    if (result < 0) {
+      if (errno == EINTR) continue;
+      return;
+    }
+
+    if (result && (count < REPLY_QUEUE_SIZE)) {
+      brlapi_packet_t packet;
+      brlapi_packetType_t type;
+
+      if (brlapi_readPacket(fd, &type, &packet, sizeof(packet)) < 0) return;
+      if (closeAfter && (++received > closeAfter)) return;
+
+      ServerReply *reply = &replies[(first + count++) % REPLY_QUEUE_SIZE];
+      getMonotonicTime(&reply->due);
+      adjustTimeValue(&reply->due, serverLatency);
+      reply->type = type;
+      reply->error = 0;
+
+      if (type == BRLAPI_PACKET_PARAM_VALUE) {
+        if (ntohl(packet.paramValue.param) == BRLAPI_PARAM_SERVER_VERSION) {
+          reply->error = BRLAPI_ERROR_READONLY_PARAMETER;
+        }
+      }
+    }
+  }
+}
+
+static void *
+runLoopbackServer (void *argument) {
+  LoopbackServer *server = argument;
+
+  while (1) {
+    int fd = accept(server->listener, NULL, NULL);
+
+    if (fd == -1) {
+      if (errno == EINTR) continue;
+      break;
+    }
+
+    {
+      static const int yes = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+    }
+
+    serveConnection(fd, server->closeAfter);
+    close(fd);
+  }
+
+  return NULL;
+}
+
+static int
+startLoopbackServer (LoopbackServer *server) {
+  if ((server->listener = socket(PF_INET, SOCK_STREAM, 0)) != -1) {
+    struct sockaddr_in address;
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    /* find a free BrlAPI port (a host of :N means port BRLAPI_SOCKETPORTNUM+N) */
+    for (server->port=90; server->port<200; server->port+=1) {
+      address.sin_port = htons(BRLAPI_SOCKETPORTNUM + server->port);
+
+      if (bind(server->listener, (struct sockaddr *)&address, sizeof(address)) != -1) {
+        if (listen(server->listener, 1) != -1) {
+          pthread_t thread;
+
+          if (pthread_create(&thread, NULL, runLoopbackServer, server) == 0) {
+            pthread_detach(thread);
+            return 1;
+          }
+        }
+
+        break;
+      }
+    }
+
+    close(server->listener);
+  }
+
+  logSystemError("loopback server");
+  return 0;
+}
+
+static brlapi_handle_t *
+connectToServer (const LoopbackServer *server) {
+  brlapi_handle_t *handle = malloc(brlapi_getHandleSize());
+
+  if (handle) {
+    char host[0X20];
+    snprintf(host, sizeof(host), "127.0.0.1:%u", server->port);
+
+    brlapi_connectionSettings_t settings = {
+      .auth = "none",
+      .host = host
+    };
+
+    if (brlapi__openConnection(handle, &settings, NULL) != BRLAPI_INVALID_FILE_DESCRIPTOR) {
+      return handle;
+    }
+
+    logMessage(LOG_ERR, "connect failed: %s", brlapi_strerror(&brlapi_error));
+    free(handle);
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+static void
+disconnectFromServer (brlapi_handle_t *handle) {
+  brlapi__closeConnection(handle);
+  free(handle);
+}
+
+static int
+testKeyRanges (brlapi_handle_t *handle) {
+  brlapi_range_t ranges[requestCount];
+  brlapi_keyRangeChange_t changes[requestCount];
+
+  for (int index=0; index<requestCount; index+=1) {
+    brlapi_range_t *range = &ranges[index];
+    range->first = range->last = BRLAPI_KEY_TYPE_CMD | index;
+
+    brlapi_keyRangeChange_t *change = &changes[index];
+    change->accept = index & 1;
+    change->ranges = range;
+    change->count = 1;
+  }
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  for (int index=0; index<requestCount; index+=1) {
+    const brlapi_keyRangeChange_t *change = &changes[index];
+
+    if ((change->accept? brlapi__acceptKeyRanges: brlapi__ignoreKeyRanges)(handle, change->ranges, change->count) == -1) {
+      logMessage(LOG_ERR, "key range change failed: %s", brlapi_strerror(&brlapi_error));
+      return 0;
+    }
+  }
+
+  long int singleTime = getMonotonicElapsed(&start);
+  getMonotonicTime(&start);
+
+  if (brlapi__changeKeyRanges(handle, changes, requestCount) == -1) {
+    logMessage(LOG_ERR, "key range changes failed: %s", brlapi_strerror(&brlapi_error));
+    return 0;
+  }
+
+  long int batchTime = getMonotonicElapsed(&start);
+
+  printf("%d key range changes: %ldms one at a time, %ldms batched\n",
+         requestCount, singleTime, batchTime);
+
+  /* a batch waits for a round trip once per pipeline's worth of requests */
+  if ((batchTime * 4) > singleTime) {
+    logMessage(LOG_ERR, "batched key range changes weren't pipelined");
+    return 0;
+  }
+
+  return 1;
+}
+
+static int
+testParameterErrors (brlapi_handle_t *handle) {
+  brlapi_request_t requests[requestCount];
+  static const uint32_t value = 1;
+  int planted = 0;
+
+  for (int index=0; index<requestCount; index+=1) {
+    brlapi_request_t *request = &requests[index];
+    int readOnly = (index % 16) == 5;
+
+    request->type = brlapi_request_setParameter;
+    request->arguments.parameter.parameter = readOnly? BRLAPI_PARAM_SERVER_VERSION: BRLAPI_PARAM_CLIENT_PRIORITY;
+    request->arguments.parameter.subparam = 0;
+    request->arguments.parameter.flags = 0;
+    request->arguments.parameter.data = &value;
+    request->arguments.parameter.len = sizeof(value);
+
+    if (readOnly) planted += 1;
+  }
+
+  int failures = brlapi__sendRequests(handle, requests, requestCount, NULL, NULL);
+  printf("%d parameter sets: %d failed (%d planted)\n", requestCount, failures, planted);
+
+  if (failures != planted) {
+    logMessage(LOG_ERR, "unexpected failure count: %d", failures);
+    return 0;
+  }
+
+  for (int index=0; index<requestCount; index+=1) {
+    int readOnly = requests[index].arguments.parameter.parameter == BRLAPI_PARAM_SERVER_VERSION;
+    int expected = readOnly? BRLAPI_ERROR_READONLY_PARAMETER: BRLAPI_ERROR_SUCCESS;
+
+    if (requests[index].error != expected) {
+      logMessage(LOG_ERR, "request %d: error %d (expected %d)",
+                 index, requests[index].error, expected);
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+static int
+testDisconnect (LoopbackServer *server) {
+  int ok = 0;
+  unsigned int acknowledged = requestCount / 2;
+
+  server->closeAfter = acknowledged;
+  brlapi_handle_t *handle = connectToServer(server);
+  server->closeAfter = 0;
+
+  if (handle) {
+    brlapi_range_t ranges[requestCount];
+    brlapi_request_t requests[requestCount];
+
+    for (int index=0; index<requestCount; index+=1) {
+      brlapi_range_t *range = &ranges[index];
+      range->first = range->last = BRLAPI_KEY_TYPE_CMD | index;
+
+      brlapi_request_t *request = &requests[index];
+      request->type = brlapi_request_acceptKeyRanges;
+      request->arguments.keyRanges.ranges = range;
+      request->arguments.keyRanges.count = 1;
+      request->error = -1;
+    }
+
+    int result = brlapi__sendRequests(handle, requests, requestCount, NULL, NULL);
+    unsigned int failed = 0;
+
+    for (int index=0; index<requestCount; index+=1) {
+      if (requests[index].error != BRLAPI_ERROR_SUCCESS) failed += 1;
+    }
+
+    printf("server closed after %u requests: result %d, %u of %d failed (%s)\n",
+           acknowledged, result, failed, requestCount,
+           brlapi_strerror(&brlapi_error));
+
+    if (result != -1) {
+      logMessage(LOG_ERR, "the lost connection wasn't reported");
+    } else if (failed < (requestCount - acknowledged)) {
+      logMessage(LOG_ERR, "unacknowledged requests weren't failed");
+    } else {
+      ok = 1;
+    }
+
+    disconnectFromServer(handle);
+  }
+
+  return ok;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "rqstest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  /* a write to the closed connection mustn't kill us */
+  signal(SIGPIPE, SIG_IGN);
+
+  static LoopbackServer server;
+
+  if (startLoopbackServer(&server)) {
+    brlapi_handle_t *handle = connectToServer(&server);
+
+    if (handle) {
+      int ok = testKeyRanges(handle) && testParameterErrors(handle);
+      disconnectFromServer(handle);
+
+      if (ok && testDisconnect(&server)) exitStatus = PROG_EXIT_SUCCESS;
+    }
+  }
+
+  return exitStatus;
+}
@@ -0,0 +1,347 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "async_alarm.h"
+#include "async_wait.h"
+#include "scr.h"
+#include "routing.h"
+
+static char *opt_keyDelay;
+static int opt_pollScreen;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "key-delay",
+    .letter = 'k',
+    .argument = "msecs",
+    .setting.string = &opt_keyDelay,
+    .internal.setting = "2",
+    .description = "how long the terminal takes to act on each key"
+  },
+
+  { .word = "poll",
+    .letter = 'p',
+    .setting.flag = &opt_pollScreen,
+    .description = "don't send screen update notifications"
+  },
+END_OPTION_TABLE
+
+static int keyDelay;
+
+static int
+validateOptions (void) {
+  static const int minimum = 0;
+
+  if (!validateInteger(&keyDelay, opt_keyDelay, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid key delay: %s", opt_keyDelay);
+    return 0;
+  }
+
+  return 1;
+}
+
+/* The simulated terminal is running a text editor: the cursor moves
+ * through the characters of the document rather than across the cells
+ * of the screen, tabs are expanded, and moving beyond either end of a line
+ * wraps to the adjacent line.
+ */
+static const char *const documentLines[] = {
+  "#include <stdio.h>",
+  "",
+  "int",
+  "main (void) {",
+  "\tprintf(\"hello\\n\");",
+  "\t\treturn 0;",
+  "}",
+  "a\tb\tc\td",
+  "the last line of the document"
+};
+
+#define SCREEN_NUMBER 1
+#define SCREEN_WIDTH 40
+#define SCREEN_HEIGHT ARRAY_COUNT(documentLines)
+#define TAB_WIDTH 8
+
+static struct {
+  int line;
+  int offset;
+  int goal;
+
+  ScreenKey keys[0X100];
+  unsigned int keyCount;
+  AsyncHandle keyAlarm;
+
+  RoutingScreenUpdatedHandler *updatedHandler;
+  void *updatedData;
+
+  unsigned int keysReceived;
+  unsigned int reads;
+} terminal = {
+  .goal = -1
+};
+
+static int
+getLineLength (int line) {
+  return strlen(documentLines[line]);
+}
+
+static int
+getDisplayColumn (int line, int offset) {
+  const char *text = documentLines[line];
+  int column = 0;
+
+  for (int index=0; index<offset; index+=1) {
+    if (text[index] == '\t') {
+      column = ((column / TAB_WIDTH) + 1) * TAB_WIDTH;
+    } else {
+      column += 1;
+    }
+  }
+
+  return column;
+}
+
+static void
+moveToLine (int line) {
+  if (terminal.goal < 0) {
+    terminal.goal = getDisplayColumn(terminal.line, terminal.offset);
+  }
+
+  int length = getLineLength(line);
+  int offset = 0;
+
+  while ((offset < length) && (getDisplayColumn(line, offset+1) <= terminal.goal)) {
+    offset += 1;
+  }
+
+  terminal.line = line;
+  terminal.offset = offset;
+}
+
+static void
+actOnKey (ScreenKey key) {
+  int last = SCREEN_HEIGHT - 1;
+
+  switch (key) {
+    case SCR_KEY_CURSOR_LEFT:
+      terminal.goal = -1;
+
+      if (terminal.offset > 0) {
+        terminal.offset -= 1;
+      } else if (terminal.line > 0) {
+        terminal.line -= 1;
+        terminal.offset = getLineLength(terminal.line);
+      }
+      break;
+
+    case SCR_KEY_CURSOR_RIGHT:
+      terminal.goal = -1;
+
+      if (terminal.offset < getLineLength(terminal.line)) {
+        terminal.offset += 1;
+      } else if (terminal.line < last) {
+        terminal.line += 1;
+        terminal.offset = 0;
+      }
+      break;
+
+    case SCR_KEY_CURSOR_UP:
+      if (terminal.line > 0) moveToLine(terminal.line - 1);
+      break;
+
+    case SCR_KEY_CURSOR_DOWN:
+      if (terminal.line < last) moveToLine(terminal.line + 1);
+      break;
+
+    default:
+      break;
+  }
+}
+
+ASYNC_ALARM_CALLBACK(handleKeyAlarm) {
+  asyncDiscardHandle(terminal.keyAlarm);
+  terminal.keyAlarm = NULL;
+
+  actOnKey(terminal.keys[0]);
+  memmove(&terminal.keys[0], &terminal.keys[1],
+          ARRAY_SIZE(terminal.keys, --terminal.keyCount));
+
+  if (terminal.keyCount) {
+    asyncNewRelativeAlarm(&terminal.keyAlarm, keyDelay, handleKeyAlarm, NULL);
+  }
+
+  if (!opt_pollScreen && terminal.updatedHandler) {
+    terminal.updatedHandler(terminal.updatedData);
+  }
+}
+
+void
+describeRoutingScreen (ScreenDescription *description) {
+  memset(description, 0, sizeof(*description));
+  description->number = SCREEN_NUMBER;
+  description->cols = SCREEN_WIDTH;
+  description->rows = SCREEN_HEIGHT;
+  description->posx = getDisplayColumn(terminal.line, terminal.offset);
+  description->posy = terminal.line;
+  description->hasCursor = 1;
+  terminal.reads += 1;
+}
+
+int
+readRoutingScreenRow (int row, int width, ScreenCharacter *buffer) {
+  if ((row < 0) || (row >= SCREEN_HEIGHT)) return 0;
+  if (width > SCREEN_WIDTH) return 0;
+
+  const char *text = documentLines[row];
+  int column = 0;
+
+  while (*text && (column < width)) {
+    int next = (*text == '\t')? (((column / TAB_WIDTH) + 1) * TAB_WIDTH): (column + 1);
+    wchar_t character = (*text == '\t')? WC_C(' '): *text;
+
+    while ((column < next) && (column < width)) {
+      buffer[column].text = character;
+      column += 1;
+    }
+
+    text += 1;
+  }
+
+  while (column < width) buffer[column++].text = WC_C(' ');
+  terminal.reads += 1;
+  return 1;
+}
+
+int
+insertRoutingScreenKey (ScreenKey key) {
+  if (terminal.keyCount == ARRAY_COUNT(terminal.keys)) return 0;
+  terminal.keys[terminal.keyCount++] = key;
+  terminal.keysReceived += 1;
+
+  if (!terminal.keyAlarm) {
+    asyncNewRelativeAlarm(&terminal.keyAlarm, keyDelay, handleKeyAlarm, NULL);
+  }
+
+  return 1;
+}
+
+int
+refreshRoutingScreen (void) {
+  return 1;
+}
+
+void
+setRoutingScreenUpdatedHandler (RoutingScreenUpdatedHandler *handler, void *data) {
+  terminal.updatedHandler = handler;
+  terminal.updatedData = data;
+}
+
+int
+pollRoutingScreen (void) {
+  return opt_pollScreen;
+}
+
+typedef struct {
+  int column;
+  int row;
+  RoutingStatus status;
+} RoutingTarget;
+
+static const RoutingTarget routingTargets[] = {
+  {.column=10, .row=0, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=12, .row=4, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=5, .row=4, .status=ROUTING_STATUS_COLUMN},
+  {.column=20, .row=5, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=25, .row=8, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=35, .row=2, .status=ROUTING_STATUS_COLUMN},
+  {.column=0, .row=6, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=24, .row=7, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=-1, .row=1, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=17, .row=7, .status=ROUTING_STATUS_SUCCEESS},
+  {.column=20, .row=7, .status=ROUTING_STATUS_COLUMN},
+  {.column=3, .row=3, .status=ROUTING_STATUS_SUCCEESS},
+};
+
+static int
+testRoutingTarget (const RoutingTarget *target) {
+  int fromColumn = getDisplayColumn(terminal.line, terminal.offset);
+  int fromRow = terminal.line;
+
+  terminal.keysReceived = 0;
+  terminal.reads = 0;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  if (!startRouting(target->column, target->row, SCREEN_NUMBER)) return 0;
+  RoutingStatus status = getRoutingStatus(1);
+  long int time = getMonotonicElapsed(&start);
+
+  printf("[%d,%d] -> [%d,%d]: status=%u keys=%u reads=%u time=%ldms\n",
+         fromColumn, fromRow, target->column, target->row,
+         status, terminal.keysReceived, terminal.reads, time);
+
+  if (status != target->status) {
+    logMessage(LOG_ERR, "unexpected routing status: %u (expected %u)",
+               status, target->status);
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "rtgtest",
+      .argumentsSummary = ""
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  if (!validateOptions()) return PROG_EXIT_SYNTAX;
+
+  unsigned int keys = 0;
+  unsigned int reads = 0;
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  for (unsigned int index=0; index<ARRAY_COUNT(routingTargets); index+=1) {
+    if (!testRoutingTarget(&routingTargets[index])) return PROG_EXIT_FATAL;
+    keys += terminal.keysReceived;
+    reads += terminal.reads;
+  }
+
+  printf("routes: %u, keys: %u, reads: %u, time: %ldms\n",
+         (unsigned int)ARRAY_COUNT(routingTargets),
+         keys, reads, getMonotonicElapsed(&start));
+
+  return PROG_EXIT_SUCCESS;
+}
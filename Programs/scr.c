@@ -244,18 +244,55 @@ getScreenCommandContext (void) {
 }
 
 
+void
+describeRoutingScreen (ScreenDescription *description) {
+  describeBaseScreen(&mainScreen.base, description);
+}
+
 int
-constructRoutingScreen (void) {
-  /* This function should be used in a forked process. Though we want to
-   * have a separate file descriptor for the main screen from the one used
-   * in the main thread.  So we close and reopen the device.
-   */
-  mainScreen.destruct();
-  return mainScreen.construct();
+readRoutingScreenRow (int row, int width, ScreenCharacter *buffer) {
+  const ScreenBox box = {
+    .left = 0,
+    .top = row,
+    .width = width,
+    .height = 1
+  };
+
+  return mainScreen.base.readCharacters(&box, buffer);
+}
+
+int
+insertRoutingScreenKey (ScreenKey key) {
+  logMessage(LOG_CATEGORY(SCREEN_DRIVER), "insert routing key: 0X%04X", key);
+  return mainScreen.base.insertKey(key);
+}
+
+int
+refreshRoutingScreen (void) {
+  return mainScreen.base.refresh();
 }
 
+static RoutingScreenUpdatedHandler *routingScreenUpdatedHandler = NULL;
+static void *routingScreenUpdatedData = NULL;
+
 void
-destructRoutingScreen (void) {
-  mainScreen.destruct();
-  mainScreen.releaseParameters();
+setRoutingScreenUpdatedHandler (RoutingScreenUpdatedHandler *handler, void *data) {
+  routingScreenUpdatedHandler = handler;
+  routingScreenUpdatedData = data;
+}
+
+int
+routingScreenUpdated (void) {
+  if (!routingScreenUpdatedHandler) return 0;
+  routingScreenUpdatedHandler(routingScreenUpdatedData);
+  return 1;
+}
+
+int
+pollRoutingScreen (void) {
+  /* Returns true if the driver can't notify us of screen updates,
+   * in which case the caller needs to poll for them. Otherwise it
+   * (re)arms the driver's update notification.
+   */
+  return mainScreen.base.poll();
 }
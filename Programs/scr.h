@@ -62,12 +62,18 @@ readScreenRow (int row, int width, ScreenCharacter *buffer) {
 }
 
 /* Routines which apply to the routing screen.
- * An extra `thread' for the cursor routing subprocess.
- * This is needed because the forked subprocess shares its parent's
- * file descriptors.  A readScreen equivalent is not needed.
+ * Cursor routing always works on the main screen, whichever screen is
+ * current, and is woken by its update notifications.
  */
-extern int constructRoutingScreen (void);
-extern void destructRoutingScreen (void);
+extern void describeRoutingScreen (ScreenDescription *description);
+extern int readRoutingScreenRow (int row, int width, ScreenCharacter *buffer);
+extern int insertRoutingScreenKey (ScreenKey key);
+extern int refreshRoutingScreen (void);
+
+typedef void RoutingScreenUpdatedHandler (void *data);
+extern void setRoutingScreenUpdatedHandler (RoutingScreenUpdatedHandler *handler, void *data);
+extern int routingScreenUpdated (void);
+extern int pollRoutingScreen (void);
 
 extern const ScreenDriver *screen;
 extern const ScreenDriver noScreen;
@@ -41,6 +41,11 @@ typedef struct {
 
   unsigned char cursorRow;
   unsigned char cursorColumn;
+
+  struct {
+    HelpPageGenerator *function;
+    void *data;
+  } generator;
 } HelpPageEntry;
 
 static HelpPageEntry *pageTable;
@@ -66,6 +71,9 @@ initializePage (HelpPageEntry *page) {
 
   page->cursorRow = 0;
   page->cursorColumn = 0;
+
+  page->generator.function = NULL;
+  page->generator.data = NULL;
 }
 
 static unsigned int
@@ -101,8 +109,9 @@ clearPage (HelpPageEntry *page) {
     }
 
     free(page->lineTable);
-    initializePage(page);
   }
+
+  initializePage(page);
 }
 
 static int
@@ -139,7 +148,22 @@ addLine (HelpPageEntry *page, const wchar_t *characters) {
 
 static HelpPageEntry *
 getPage (void) {
-  if (pageIndex < pageCount) return &pageTable[pageIndex];
+  if (pageIndex < pageCount) {
+    HelpPageEntry *page = &pageTable[pageIndex];
+    HelpPageGenerator *generator = page->generator.function;
+
+    if (generator) {
+      /* the generator adds its lines to this page via getPage() */
+      page->generator.function = NULL;
+
+      if (!generator(page->generator.data)) {
+        logMessage(LOG_WARNING, "help page not generated: %u", pageIndex+1);
+      }
+    }
+
+    return page;
+  }
+
   logMessage(LOG_WARNING, "help page index out of range: %u >= %u", pageIndex, pageCount);
   return NULL;
 }
@@ -191,6 +215,21 @@ clearPage_HelpScreen (void) {
   return 1;
 }
 
+static int
+setPageGenerator_HelpScreen (HelpPageGenerator *generator, void *data) {
+  if (pageIndex < pageCount) {
+    HelpPageEntry *page = &pageTable[pageIndex];
+
+    clearPage(page);
+    page->generator.function = generator;
+    page->generator.data = data;
+    return 1;
+  }
+
+  logMessage(LOG_WARNING, "help page index out of range: %u >= %u", pageIndex, pageCount);
+  return 0;
+}
+
 static int
 addLine_HelpScreen (const wchar_t *characters) {
   HelpPageEntry *page = getPage();
@@ -343,6 +382,7 @@ initializeHelpScreen (HelpScreen *help) {
   help->setPageNumber = setPageNumber_HelpScreen;
 
   help->clearPage = clearPage_HelpScreen;
+  help->setPageGenerator = setPageGenerator_HelpScreen;
   help->addLine = addLine_HelpScreen;
   help->getLineCount = getLineCount_HelpScreen;
 }
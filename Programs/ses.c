@@ -23,6 +23,8 @@
 #include "log.h"
 #include "ses.h"
 #include "defaults.h"
+#include "parameters.h"
+#include "timing.h"
 
 static const SessionEntry initialSessionEntry = {
   .number = 0,
@@ -34,56 +36,166 @@ static const SessionEntry initialSessionEntry = {
   .ptry = -1
 };
 
-static SessionEntry **sessionArray = NULL;
-static unsigned int sessionLimit = 0;
-static unsigned int sessionCount = 0;
+typedef struct SessionNodeStruct SessionNode;
+
+struct SessionNodeStruct {
+  SessionEntry entry;
+  SessionNode *next;
+  TimeValue lastUsed;
+};
+
+typedef struct SessionPoolStruct SessionPool;
+
+struct SessionPoolStruct {
+  SessionPool *next;
+  SessionNode nodes[SESSION_POOL_SIZE];
+};
+
+static SessionPool *sessionPools = NULL;
+static SessionNode *freeSessionNodes = NULL;
+
+static SessionNode *directSessions[SESSION_DIRECT_LIMIT];
+static SessionNode *hashedSessions[SESSION_HASH_SIZE];
+static unsigned int hashedSessionCount = 0;
+
+static SessionNode *currentSession = NULL;
+
+static SessionNode *
+allocateSessionNode (void) {
+  if (!freeSessionNodes) {
+    SessionPool *pool;
+
+    if (!(pool = malloc(sizeof(*pool)))) {
+      logMallocError();
+      return NULL;
+    }
+
+    pool->next = sessionPools;
+    sessionPools = pool;
+
+    for (unsigned int index=0; index<ARRAY_COUNT(pool->nodes); index+=1) {
+      SessionNode *node = &pool->nodes[index];
+      node->next = freeSessionNodes;
+      freeSessionNodes = node;
+    }
+  }
+
+  {
+    SessionNode *node = freeSessionNodes;
+    freeSessionNodes = node->next;
+    return node;
+  }
+}
+
+static void
+deallocateSessionNode (SessionNode *node) {
+  node->next = freeSessionNodes;
+  freeSessionNodes = node;
+}
+
+static inline int
+isDirectSession (int number) {
+  return (number >= 0) && (number < SESSION_DIRECT_LIMIT);
+}
+
+static inline SessionNode **
+getSessionBucket (int number) {
+  uint32_t hash = (uint32_t)number * UINT32_C(0X9E3779B1);
+  hash ^= hash >> 16;
+  return &hashedSessions[hash % SESSION_HASH_SIZE];
+}
+
+static void
+evictSessionEntries (const TimeValue *now) {
+  SessionNode **oldest = NULL;
+
+  for (unsigned int bucket=0; bucket<ARRAY_COUNT(hashedSessions); bucket+=1) {
+    SessionNode **node = &hashedSessions[bucket];
+
+    while (*node) {
+      if (*node != currentSession) {
+        if (millisecondsBetween(&(*node)->lastUsed, now) > SESSION_IDLE_LIMIT) {
+          SessionNode *idle = *node;
+
+          logMessage(LOG_DEBUG, "evicting idle session: %d", idle->entry.number);
+          *node = idle->next;
+          deallocateSessionNode(idle);
+          hashedSessionCount -= 1;
+          continue;
+        }
+
+        if (!oldest || (compareTimeValues(&(*node)->lastUsed, &(*oldest)->lastUsed) < 0)) {
+          oldest = node;
+        }
+      }
+
+      node = &(*node)->next;
+    }
+  }
+
+  if (oldest && (hashedSessionCount >= SESSION_ENTRY_LIMIT)) {
+    SessionNode *node = *oldest;
+
+    logMessage(LOG_DEBUG, "evicting oldest session: %d", node->entry.number);
+    *oldest = node->next;
+    deallocateSessionNode(node);
+    hashedSessionCount -= 1;
+  }
+}
 
 SessionEntry *
 getSessionEntry (int number) {
-  int first = 0;
-  int last = sessionCount - 1;
-
-  while (first <= last) {
-    int current = (first + last) / 2;
-    SessionEntry *entry = sessionArray[current];
-    if (number == entry->number) return entry;
-
-    if (number < entry->number) {
-      last = current - 1;
-    } else {
-      first = current + 1;
-    }
+  SessionNode **slot;
+  TimeValue now;
+
+  if (currentSession) {
+    if (currentSession->entry.number == number) return &currentSession->entry;
   }
 
-  if (sessionCount == sessionLimit) {
-    unsigned int newLimit = sessionLimit? sessionLimit<<1: 0X10;
-    SessionEntry **newArray;
+  /* only hashed sessions are evicted so only they need to be timestamped */
+  if (!isDirectSession(number) || (currentSession && !isDirectSession(currentSession->entry.number))) {
+    getMonotonicTime(&now);
+    if (currentSession) currentSession->lastUsed = now;
+  }
 
-    if ((newArray = realloc(sessionArray, ARRAY_SIZE(newArray, newLimit)))) {
-      sessionArray = newArray;
-      sessionLimit = newLimit;
-    } else {
-      logMallocError();
+  if (isDirectSession(number)) {
+    slot = &directSessions[number];
+  } else {
+    slot = getSessionBucket(number);
+
+    while (*slot) {
+      if ((*slot)->entry.number == number) break;
+      slot = &(*slot)->next;
+    }
+
+    if (!*slot) {
+      evictSessionEntries(&now);
+      slot = getSessionBucket(number);
+      while (*slot) slot = &(*slot)->next;
     }
   }
 
-  if (sessionCount < sessionLimit) {
-    SessionEntry *entry = malloc(sizeof(*entry));
+  if (!*slot) {
+    SessionNode *node = allocateSessionNode();
 
-    if (entry) {
-      *entry = initialSessionEntry;
-      entry->number = number;
+    if (node) {
+      node->entry = initialSessionEntry;
+      node->entry.number = number;
+      node->next = NULL;
 
-      memmove(&sessionArray[first+1], &sessionArray[first],
-              ARRAY_SIZE(sessionArray, sessionCount-first));
-      sessionArray[first] = entry;
-      sessionCount += 1;
-      return entry;
-    } else {
-      logMallocError();
+      *slot = node;
+      if (!isDirectSession(number)) hashedSessionCount += 1;
     }
   }
 
+  if (*slot) {
+    currentSession = *slot;
+    if (!isDirectSession(number)) currentSession->lastUsed = now;
+    return &currentSession->entry;
+  }
+
+  currentSession = NULL;
+
   {
     static SessionEntry fallbackEntry;
     static int initialized = 0;
@@ -99,12 +211,16 @@ getSessionEntry (int number) {
 
 void
 deallocateSessionEntries (void) {
-  if (sessionArray) {
-    while (sessionCount > 0) free(sessionArray[--sessionCount]);
-    free(sessionArray);
-    sessionArray = NULL;
-  } else {
-    sessionCount = 0;
+  while (sessionPools) {
+    SessionPool *pool = sessionPools;
+    sessionPools = pool->next;
+    free(pool);
   }
-  sessionLimit = 0;
+
+  freeSessionNodes = NULL;
+  currentSession = NULL;
+
+  memset(directSessions, 0, sizeof(directSessions));
+  memset(hashedSessions, 0, sizeof(hashedSessions));
+  hashedSessionCount = 0;
 }
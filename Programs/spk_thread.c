@@ -24,6 +24,7 @@
 #include "parameters.h"
 #include "log.h"
 #include "strfmt.h"
+#include "timing.h"
 #include "prefs.h"
 #include "spk_thread.h"
 #include "spk.h"
@@ -78,10 +79,21 @@ typedef enum {
   RSP_INTEGER
 } SpeechResponseType;
 
+typedef struct SpeechRequestStruct SpeechRequest;
+
 struct SpeechDriverThreadStruct {
   ThreadState threadState;
   Queue *requestQueue;
 
+  struct {
+    unsigned int inFlight;
+    unsigned int serialNumber;
+    volatile unsigned int muteGeneration;
+
+    unsigned char *pool;
+    SpeechRequest *available;
+  } requests;
+
   SpeechSynthesizer *speechSynthesizer;
   char **driverParameters;
 
@@ -89,11 +101,13 @@ struct SpeechDriverThreadStruct {
   pthread_t threadIdentifier;
   AsyncEvent *requestEvent;
   AsyncEvent *messageEvent;
+  AsyncEvent *finishedEvent;
   unsigned isBeingDestroyed:1;
 #endif /* GOT_PTHREADS */
 
   struct {
     SpeechResponseType type;
+    unsigned int serialNumber;
 
     union {
       int INTEGER;
@@ -123,8 +137,14 @@ static const char *const speechRequestNames[] = {
   [REQ_SET_PUNCTUATION] = "set punctuation"
 };
 
-typedef struct {
+struct SpeechRequestStruct {
+  SpeechRequest *next;
   SpeechRequestType type;
+  unsigned int serialNumber;
+  unsigned int muteGeneration;
+  TimeValue enqueueTime;
+  int result;
+  unsigned isPooled:1;
 
   union {
     struct {
@@ -153,7 +173,16 @@ typedef struct {
   } arguments;
 
   unsigned char data[0];
-} SpeechRequest;
+};
+
+/* Requests are allocated from (and released to) a pool which is allocated
+ * along with the thread so that speaking doesn't mean a malloc for every
+ * request. A request whose data doesn't fit into a slot, or which is made
+ * while every slot is in use, is allocated on its own. Requests are only
+ * ever allocated and released by the core thread - the driver thread hands
+ * each one back, with its result, once it has been handled.
+ */
+#define SPEECH_REQUEST_SLOT_SIZE (sizeof(SpeechRequest) + SPEECH_REQUEST_DATA_SIZE)
 
 typedef struct {
   const void *address;
@@ -305,6 +334,48 @@ moveSpeechData (unsigned char *target, SpeechDatum *data) {
   }
 }
 
+static int
+allocateSpeechRequestPool (SpeechDriverThread *sdt) {
+  unsigned char *pool;
+
+  if ((pool = malloc(SPEECH_REQUEST_POOL_SIZE * SPEECH_REQUEST_SLOT_SIZE))) {
+    sdt->requests.pool = pool;
+    sdt->requests.available = NULL;
+
+    for (unsigned int index=0; index<SPEECH_REQUEST_POOL_SIZE; index+=1) {
+      SpeechRequest *req = (SpeechRequest *)(pool + (index * SPEECH_REQUEST_SLOT_SIZE));
+
+      req->next = sdt->requests.available;
+      sdt->requests.available = req;
+    }
+
+    return 1;
+  } else {
+    logMallocError();
+  }
+
+  return 0;
+}
+
+static void
+deallocateSpeechRequestPool (SpeechDriverThread *sdt) {
+  free(sdt->requests.pool);
+  sdt->requests.pool = NULL;
+  sdt->requests.available = NULL;
+}
+
+static void
+releaseSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
+  if (req) {
+    if (req->isPooled) {
+      req->next = sdt->requests.available;
+      sdt->requests.available = req;
+    } else {
+      free(req);
+    }
+  }
+}
+
 static inline void
 setResponsePending (SpeechDriverThread *sdt) {
   sdt->response.type = RSP_PENDING;
@@ -327,7 +398,44 @@ awaitSpeechResponse (SpeechDriverThread *sdt, int timeout) {
   return asyncAwaitCondition(timeout, testSpeechResponseReceived, (void *)sdt);
 }
 
-static void sendSpeechRequest (SpeechDriverThread *sdt);
+typedef struct {
+  const SpeechDriverThread *const sdt;
+  const unsigned int serialNumber;
+} AwaitSpeechRequestData;
+
+ASYNC_CONDITION_TESTER(testSpeechRequestFinished) {
+  const AwaitSpeechRequestData *asr = data;
+
+  /* requests are handled, and so finish, in the order they're sent */
+  return (int)(asr->sdt->response.serialNumber - asr->serialNumber) >= 0;
+}
+
+static int
+awaitSpeechRequest (SpeechDriverThread *sdt, unsigned int serialNumber, int timeout) {
+  AwaitSpeechRequestData asr = {
+    .sdt = sdt,
+    .serialNumber = serialNumber
+  };
+
+  return asyncAwaitCondition(timeout, testSpeechRequestFinished, &asr);
+}
+
+static void sendSpeechRequests (SpeechDriverThread *sdt);
+
+/* Each request has its own response: its result is the response, and its
+ * serial number says which request the response is for.
+ */
+static void
+handleFinishedSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
+  logSpeechRequest(req, "finished");
+
+  if (sdt->requests.inFlight) sdt->requests.inFlight -= 1;
+  sendSpeechRequests(sdt);
+
+  sdt->response.serialNumber = req->serialNumber;
+  setIntegerResponse(sdt, req->result);
+  releaseSpeechRequest(sdt, req);
+}
 
 static void
 handleSpeechMessage (SpeechDriverThread *sdt, SpeechMessage *msg) {
@@ -336,8 +444,10 @@ handleSpeechMessage (SpeechDriverThread *sdt, SpeechMessage *msg) {
   if (msg) {
     switch (msg->type) {
       case MSG_REQUEST_FINISHED:
+        /* the thread itself has started or stopped */
+        if (sdt->requests.inFlight) sdt->requests.inFlight -= 1;
+        sendSpeechRequests(sdt);
         setIntegerResponse(sdt, msg->arguments.requestFinished.result);
-        sendSpeechRequest(sdt);
         break;
 
       case MSG_SPEECH_FINISHED: {
@@ -448,15 +558,60 @@ sendIntegerResponse (SpeechDriverThread *sdt, int result) {
   return speechMessage_requestFinished(sdt, result);
 }
 
+static void
+finishSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req, int result) {
+  req->result = result;
+
+#ifdef GOT_PTHREADS
+  if (!asyncSignalEvent(sdt->finishedEvent, req)) {
+    /* the request can't be released by this thread */
+    sendIntegerResponse(sdt, result);
+  }
+#else /* GOT_PTHREADS */
+  handleFinishedSpeechRequest(sdt, req);
+#endif /* GOT_PTHREADS */
+}
+
+static int
+isSupersededSpeechRequest (SpeechDriverThread *sdt, const SpeechRequest *req) {
+  switch (req->type) {
+    case REQ_SAY_TEXT:
+    case REQ_MUTE_SPEECH:
+      __sync_synchronize();
+      return req->muteGeneration != sdt->requests.muteGeneration;
+
+    default:
+      return 0;
+  }
+}
+
 static void
 handleSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
   SpeechSynthesizer *spk = sdt->speechSynthesizer;
 
   logSpeechRequest(req, "handling");
 
+  if (req && isSupersededSpeechRequest(sdt, req)) {
+    /* A later mute has already been queued, so this would be cut off anyway. */
+    logSpeechRequest(req, "skipping superseded");
+    finishSpeechRequest(sdt, req, 1);
+    return;
+  }
+
   if (req) {
+    int result = 1;
+
     switch (req->type) {
       case REQ_SAY_TEXT: {
+        {
+          TimeValue now;
+          getMonotonicTime(&now);
+
+          logMessage(LOG_CATEGORY(SPEECH_EVENTS),
+                     "say text latency: %ldms",
+                     millisecondsBetween(&req->enqueueTime, &now));
+        }
+
         SayOptions options = req->arguments.sayText.options;
         int restorePitch = 0;
         int restorePunctuation = 0;
@@ -494,60 +649,46 @@ handleSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
 
         if (restorePunctuation) spk->setPunctuation(spk, prefs.speechPunctuation);
         if (restorePitch) spk->setPitch(spk, prefs.speechPitch);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_MUTE_SPEECH: {
         speech->mute(spk);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_DRAIN_SPEECH: {
         spk->drain(spk);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_SET_VOLUME: {
         spk->setVolume(spk, req->arguments.setVolume.setting);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_SET_RATE: {
         spk->setRate(spk, req->arguments.setRate.setting);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_SET_PITCH: {
         spk->setPitch(spk, req->arguments.setPitch.setting);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       case REQ_SET_PUNCTUATION: {
         spk->setPunctuation(spk, req->arguments.setPunctuation.setting);
-
-        sendIntegerResponse(sdt, 1);
         break;
       }
 
       default:
         logMessage(LOG_CATEGORY(SPEECH_EVENTS), "unimplemented request: %u", req->type);
-        sendIntegerResponse(sdt, 0);
+        result = 0;
         break;
     }
 
-    free(req);
+    finishSpeechRequest(sdt, req, result);
   } else {
     setThreadState(sdt, THD_STOPPING);
     sendIntegerResponse(sdt, 1);
@@ -585,29 +726,34 @@ removeSpeechRequests (SpeechDriverThread *sdt, SpeechRequestType type) {
 
 static void
 muteSpeechRequestQueue (SpeechDriverThread *sdt) {
+  if (!testThreadValidity(sdt)) return;
+
   removeSpeechRequests(sdt, REQ_SAY_TEXT);
   removeSpeechRequests(sdt, REQ_MUTE_SPEECH);
+
+  /* Requests which have already been sent are superseded too. */
+  sdt->requests.muteGeneration += 1;
+  __sync_synchronize();
 }
 
 static void
-sendSpeechRequest (SpeechDriverThread *sdt) {
+sendSpeechRequests (SpeechDriverThread *sdt) {
   while (getQueueSize(sdt->requestQueue) > 0) {
+    if (sdt->requests.inFlight >= SPEECH_REQUEST_PIPELINE_DEPTH) break;
     SpeechRequest *req = dequeueItem(sdt->requestQueue);
 
     logSpeechRequest(req, "sending");
     setResponsePending(sdt);
+    sdt->requests.inFlight += 1;
 
 #ifdef GOT_PTHREADS
     if (!asyncSignalEvent(sdt->requestEvent, req)) {
-      if (req) free(req);
-      setIntegerResponse(sdt, 0);
-      continue;
+      releaseSpeechRequest(sdt, req);
+      if (!(sdt->requests.inFlight -= 1)) setIntegerResponse(sdt, 0);
     }
 #else /* GOT_PTHREADS */
     handleSpeechRequest(sdt, req);
 #endif /* GOT_PTHREADS */
-
-    break;
   }
 }
 
@@ -615,14 +761,16 @@ static int
 enqueueSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
   if (testThreadValidity(sdt)) {
     logSpeechRequest(req, "enqueuing");
+    sdt->requests.serialNumber += 1;
 
-    if (enqueueItem(sdt->requestQueue, req)) {
-      if (sdt->response.type != RSP_PENDING) {
-        if (getQueueSize(sdt->requestQueue) == 1) {
-          sendSpeechRequest(sdt);
-        }
-      }
+    if (req) {
+      req->serialNumber = sdt->requests.serialNumber;
+      req->muteGeneration = sdt->requests.muteGeneration;
+      getMonotonicTime(&req->enqueueTime);
+    }
 
+    if (enqueueItem(sdt->requestQueue, req)) {
+      sendSpeechRequests(sdt);
       return 1;
     }
   }
@@ -631,20 +779,24 @@ enqueueSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
 }
 
 static SpeechRequest *
-newSpeechRequest (SpeechRequestType type, SpeechDatum *data) {
+newSpeechRequest (SpeechDriverThread *sdt, SpeechRequestType type, SpeechDatum *data) {
   SpeechRequest *req;
-  size_t size = sizeof(*req) + getSpeechDataSize(data);
+  size_t size = getSpeechDataSize(data);
+  int isPooled = sdt && (size <= SPEECH_REQUEST_DATA_SIZE) && sdt->requests.available;
 
-  if ((req = malloc(size))) {
-    memset(req, 0, sizeof(*req));
-    req->type = type;
-    moveSpeechData(req->data, data);
-    return req;
-  } else {
+  if (isPooled) {
+    req = sdt->requests.available;
+    sdt->requests.available = req->next;
+  } else if (!(req = malloc(sizeof(*req) + size))) {
     logMallocError();
+    return NULL;
   }
 
-  return NULL;
+  memset(req, 0, sizeof(*req));
+  req->type = type;
+  req->isPooled = isPooled;
+  moveSpeechData(req->data, data);
+  return req;
 }
 
 int
@@ -661,7 +813,7 @@ speechRequest_sayText (
     {.address=attributes, .size=count},
   END_SPEECH_DATA
 
-  if ((req = newSpeechRequest(REQ_SAY_TEXT, data))) {
+  if ((req = newSpeechRequest(sdt, REQ_SAY_TEXT, data))) {
     req->arguments.sayText.text = data[0].address;
     req->arguments.sayText.length = length;
     req->arguments.sayText.count = count;
@@ -671,7 +823,7 @@ speechRequest_sayText (
     if (options & SAY_OPT_MUTE_FIRST) muteSpeechRequestQueue(sdt);
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -683,11 +835,11 @@ speechRequest_muteSpeech (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_MUTE_SPEECH, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_MUTE_SPEECH, NULL))) {
     muteSpeechRequestQueue(sdt);
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -699,13 +851,13 @@ speechRequest_drainSpeech (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_DRAIN_SPEECH, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_DRAIN_SPEECH, NULL))) {
     if (enqueueSpeechRequest(sdt, req)) {
-      awaitSpeechResponse(sdt, SPEECH_RESPONSE_WAIT_TIMEOUT);
+      awaitSpeechRequest(sdt, sdt->requests.serialNumber, SPEECH_RESPONSE_WAIT_TIMEOUT);
       return 1;
     }
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -718,11 +870,11 @@ speechRequest_setVolume (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_SET_VOLUME, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_SET_VOLUME, NULL))) {
     req->arguments.setVolume.setting = setting;
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -735,11 +887,11 @@ speechRequest_setRate (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_SET_RATE, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_SET_RATE, NULL))) {
     req->arguments.setRate.setting = setting;
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -752,11 +904,11 @@ speechRequest_setPitch (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_SET_PITCH, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_SET_PITCH, NULL))) {
     req->arguments.setPitch.setting = setting;
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -769,11 +921,11 @@ speechRequest_setPunctuation (
 ) {
   SpeechRequest *req;
 
-  if ((req = newSpeechRequest(REQ_SET_PUNCTUATION, NULL))) {
+  if ((req = newSpeechRequest(sdt, REQ_SET_PUNCTUATION, NULL))) {
     req->arguments.setPunctuation.setting = setting;
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
-    free(req);
+    releaseSpeechRequest(sdt, req);
   }
 
   return 0;
@@ -811,6 +963,13 @@ ASYNC_EVENT_CALLBACK(handleSpeechMessageEvent) {
   handleSpeechMessage(sdt, msg);
 }
 
+ASYNC_EVENT_CALLBACK(handleFinishedSpeechRequestEvent) {
+  SpeechDriverThread *sdt = parameters->eventData;
+  SpeechRequest *req = parameters->signalData;
+
+  handleFinishedSpeechRequest(sdt, req);
+}
+
 ASYNC_EVENT_CALLBACK(handleSpeechRequestEvent) {
   SpeechDriverThread *sdt = parameters->eventData;
   SpeechRequest *req = parameters->signalData;
@@ -861,7 +1020,7 @@ deallocateSpeechRequest (void *item, void *data) {
   SpeechRequest *req = item;
 
   logSpeechRequest(req, "unqueuing");
-  free(req);
+  releaseSpeechRequest(data, req);
 }
 
 int
@@ -879,49 +1038,61 @@ constructSpeechDriverThread (
     sdt->speechSynthesizer = spk;
     sdt->driverParameters = parameters;
 
-    if ((sdt->requestQueue = newQueue(deallocateSpeechRequest, NULL))) {
-      spk->driver.thread = sdt;
+    if (allocateSpeechRequestPool(sdt)) {
+      if ((sdt->requestQueue = newQueue(deallocateSpeechRequest, NULL))) {
+        setQueueData(sdt->requestQueue, sdt);
+        spk->driver.thread = sdt;
 
 #ifdef GOT_PTHREADS
-      if ((sdt->messageEvent = asyncNewEvent(handleSpeechMessageEvent, (void *)sdt))) {
-        pthread_t threadIdentifier;
-        int createError = createThread("speech-driver",
-                                       &threadIdentifier, NULL,
-                                       runSpeechDriverThread, (void *)sdt);
-
-        if (!createError) {
-          sdt->threadIdentifier = threadIdentifier;
-
-          if (awaitSpeechResponse(sdt, SPEECH_DRIVER_THREAD_START_TIMEOUT)) {
-            if (sdt->response.type == RSP_INTEGER) {
-              if (sdt->response.value.INTEGER) {
-                return 1;
+        if ((sdt->messageEvent = asyncNewEvent(handleSpeechMessageEvent, (void *)sdt))) {
+          if ((sdt->finishedEvent = asyncNewLimitedEvent(handleFinishedSpeechRequestEvent, (void *)sdt, SPEECH_REQUEST_PIPELINE_DEPTH))) {
+            pthread_t threadIdentifier;
+            int createError = createThread("speech-driver",
+                                           &threadIdentifier, NULL,
+                                           runSpeechDriverThread, (void *)sdt);
+
+            if (!createError) {
+              sdt->threadIdentifier = threadIdentifier;
+
+              if (awaitSpeechResponse(sdt, SPEECH_DRIVER_THREAD_START_TIMEOUT)) {
+                if (sdt->response.type == RSP_INTEGER) {
+                  if (sdt->response.value.INTEGER) {
+                    return 1;
+                  }
+                }
+
+                logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread initialization failure");
+                awaitSpeechDriverThreadTermination(sdt);
+              } else {
+                logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread initialization timeout");
               }
+            } else {
+              logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread creation failure: %s", strerror(createError));
             }
 
-            logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread initialization failure");
-            awaitSpeechDriverThreadTermination(sdt);
+            asyncDiscardEvent(sdt->finishedEvent);
+            sdt->finishedEvent = NULL;
           } else {
-            logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread initialization timeout");
+            logMessage(LOG_CATEGORY(SPEECH_EVENTS), "finished request event construction failure");
           }
+
+          asyncDiscardEvent(sdt->messageEvent);
+          sdt->messageEvent = NULL;
         } else {
-          logMessage(LOG_CATEGORY(SPEECH_EVENTS), "driver thread creation failure: %s", strerror(createError));
+          logMessage(LOG_CATEGORY(SPEECH_EVENTS), "response event construction failure");
         }
-
-        asyncDiscardEvent(sdt->messageEvent);
-        sdt->messageEvent = NULL;
-      } else {
-        logMessage(LOG_CATEGORY(SPEECH_EVENTS), "response event construction failure");
-      }
 #else /* GOT_PTHREADS */
-      if (startSpeechDriver(sdt)) {
-        setThreadReady(sdt);
-        return 1;
-      }
+        if (startSpeechDriver(sdt)) {
+          setThreadReady(sdt);
+          return 1;
+        }
 #endif /* GOT_PTHREADS */
 
-      spk->driver.thread = NULL;
-      deallocateQueue(sdt->requestQueue);
+        spk->driver.thread = NULL;
+        deallocateQueue(sdt->requestQueue);
+      }
+
+      deallocateSpeechRequestPool(sdt);
     }
 
     free((void *)sdt);
@@ -950,6 +1121,7 @@ destroySpeechDriverThread (SpeechSynthesizer *spk) {
     awaitSpeechDriverThreadTermination(sdt);
   }
 
+  if (sdt->finishedEvent) asyncDiscardEvent(sdt->finishedEvent);
   if (sdt->messageEvent) asyncDiscardEvent(sdt->messageEvent);
 #else /* GOT_PTHREADS */
   stopSpeechDriver(sdt);
@@ -958,6 +1130,7 @@ destroySpeechDriverThread (SpeechSynthesizer *spk) {
 
   sdt->speechSynthesizer->driver.thread = NULL;
   deallocateQueue(sdt->requestQueue);
+  deallocateSpeechRequestPool(sdt);
   free((void *)sdt);
 }
 #endif /* ENABLE_SPEECH_SUPPORT */
@@ -180,7 +180,7 @@ callThreadFunction (
     .returned = 0
   };
 
-  if ((ctf.event = asyncNewEvent(handleThreadFunctionReturned, &ctf))) {
+  if ((ctf.event = asyncNewLimitedEvent(handleThreadFunctionReturned, &ctf, 1))) {
     pthread_t thread;
     int error = createThread(name, &thread, NULL, runThreadFunction, &ctf);
 
@@ -0,0 +1,180 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "queue.h"
+#include "uevent.h"
+#include "uevent_internal.h"
+
+struct UeventListenerInstanceStruct {
+  char *subsystem;
+  UeventListener *listener;
+  void *data;
+};
+
+static Queue *ueventListeners = NULL;
+
+static void
+deallocateUeventListenerInstance (void *item, void *data) {
+  UeventListenerInstance *uli = item;
+
+  logSymbol(LOG_DEBUG, uli->listener, "uevent listener unregistered: %s",
+            (uli->subsystem? uli->subsystem: "*"));
+
+  if (uli->subsystem) free(uli->subsystem);
+  free(uli);
+}
+
+UeventListenerInstance *
+registerUeventListener (const char *subsystem, UeventListener *listener, void *data) {
+  if (!ueventListeners) {
+    if (!(ueventListeners = newQueue(deallocateUeventListenerInstance, NULL))) {
+      return NULL;
+    }
+  }
+
+  if (!startUeventMonitor()) {
+    logMessage(LOG_DEBUG, "uevent monitor not started");
+  } else {
+    UeventListenerInstance *uli;
+
+    if ((uli = malloc(sizeof(*uli)))) {
+      memset(uli, 0, sizeof(*uli));
+      uli->listener = listener;
+      uli->data = data;
+
+      if (!subsystem || (uli->subsystem = strdup(subsystem))) {
+        if (enqueueItem(ueventListeners, uli)) {
+          logSymbol(LOG_DEBUG, listener, "uevent listener registered: %s",
+                    (subsystem? subsystem: "*"));
+          return uli;
+        }
+
+        if (uli->subsystem) free(uli->subsystem);
+      } else {
+        logMallocError();
+      }
+
+      free(uli);
+    } else {
+      logMallocError();
+    }
+
+    if (!getQueueSize(ueventListeners)) stopUeventMonitor();
+  }
+
+  return NULL;
+}
+
+void
+unregisterUeventListener (UeventListenerInstance *uli) {
+  deleteItem(ueventListeners, uli);
+  if (!getQueueSize(ueventListeners)) stopUeventMonitor();
+}
+
+const char *
+getUeventProperty (const UeventListenerParameters *parameters, const char *name) {
+  size_t length = strlen(name);
+  const char *const *property = parameters->properties;
+
+  while (*property) {
+    if ((strncmp(*property, name, length) == 0) && ((*property)[length] == '=')) {
+      return *property + length + 1;
+    }
+
+    property += 1;
+  }
+
+  return NULL;
+}
+
+static int
+tellUeventListener (void *item, void *data) {
+  UeventListenerInstance *uli = item;
+  UeventListenerParameters *parameters = data;
+
+  if (uli->subsystem) {
+    if (!parameters->subsystem) return 0;
+    if (strcmp(uli->subsystem, parameters->subsystem) != 0) return 0;
+  }
+
+  parameters->listenerData = uli->data;
+  uli->listener(parameters);
+  return 0;
+}
+
+int
+handleUeventMessage (const void *buffer, size_t size) {
+  static const char label[] = "kobject uevent";
+
+  char strings[size + 1];
+  memcpy(strings, buffer, size);
+  strings[size] = 0;
+
+  const char *end = strings + size;
+  unsigned int count = 0;
+
+  for (const char *string=strings; string<end; string+=strlen(string)+1) {
+    count += 1;
+  }
+
+  if (!count) return 0;
+
+  const char *header = strings;
+  const char *separator = strchr(header, '@');
+
+  if (!separator) {
+    logMessage(LOG_DEBUG, "%s ignored: %s", label, header);
+    return 0;
+  }
+
+  const char *properties[count];
+  unsigned int propertyCount = 0;
+
+  for (const char *string=header+strlen(header)+1; string<end; string+=strlen(string)+1) {
+    if (strchr(string, '=')) properties[propertyCount++] = string;
+  }
+
+  properties[propertyCount] = NULL;
+
+  char action[separator - header + 1];
+  memcpy(action, header, sizeof(action)-1);
+  action[sizeof(action)-1] = 0;
+
+  UeventListenerParameters parameters = {
+    .action = action,
+    .device = separator + 1,
+    .subsystem = NULL,
+    .properties = properties,
+    .listenerData = NULL
+  };
+
+  parameters.subsystem = getUeventProperty(&parameters, "SUBSYSTEM");
+
+  logMessage(LOG_DEBUG, "%s: %s %s (%s)",
+             label, parameters.action, parameters.device,
+             (parameters.subsystem? parameters.subsystem: "?"));
+
+  if (ueventListeners) processQueue(ueventListeners, tellUeventListener, &parameters);
+  return 1;
+}
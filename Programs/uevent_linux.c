@@ -0,0 +1,172 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2021 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#include "prologue.h"
+
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#include "log.h"
+#include "async_io.h"
+#include "async_alarm.h"
+#include "uevent.h"
+#include "uevent_internal.h"
+#include "parameters.h"
+
+#ifdef NETLINK_KOBJECT_UEVENT
+static int ueventSocket = -1;
+static AsyncHandle ueventMonitor = NULL;
+static AsyncHandle ueventRestartAlarm = NULL;
+
+static int monitorUeventSocket (void);
+
+ASYNC_ALARM_CALLBACK(handleUeventRestartAlarm) {
+  if (monitorUeventSocket()) {
+    logMessage(LOG_DEBUG, "kobject uevent monitor restarted");
+
+    asyncCancelRequest(ueventRestartAlarm);
+    ueventRestartAlarm = NULL;
+  }
+}
+
+ASYNC_MONITOR_CALLBACK(handleUeventInput) {
+  if (parameters->error) {
+    logMessage(LOG_WARNING, "kobject uevent monitor error: %s", strerror(parameters->error));
+
+    asyncDiscardHandle(ueventMonitor);
+    ueventMonitor = NULL;
+
+    close(ueventSocket);
+    ueventSocket = -1;
+
+    /* the listeners are still registered so keep trying to reopen it */
+    if (asyncNewRelativeAlarm(&ueventRestartAlarm, UEVENT_MONITOR_RESTART_INTERVAL,
+                              handleUeventRestartAlarm, NULL)) {
+      asyncResetAlarmInterval(ueventRestartAlarm, UEVENT_MONITOR_RESTART_INTERVAL);
+    }
+
+    return 0;
+  } else {
+    while (1) {
+      unsigned char buffer[0X2000];
+      ssize_t length = recv(ueventSocket, buffer, sizeof(buffer), MSG_DONTWAIT);
+
+      if (length == -1) {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+          logSystemError("kobject uevent receive");
+        }
+
+        break;
+      }
+
+      handleUeventMessage(buffer, length);
+    }
+  }
+
+  return 1;
+}
+
+static int
+openUeventSocket (void) {
+  const struct sockaddr_nl socketAddress = {
+    .nl_family = AF_NETLINK,
+    .nl_pid = 0,
+    .nl_groups = 1 /* the kernel's own events (udev's are duplicates) */
+  };
+
+  int socketDescriptor = socket(PF_NETLINK, SOCK_DGRAM, NETLINK_KOBJECT_UEVENT);
+
+  if (socketDescriptor != -1) {
+    if (bind(socketDescriptor, (const struct sockaddr *)&socketAddress, sizeof(socketAddress)) != -1) {
+      logMessage(LOG_DEBUG,
+        "netlink kobject uevent socket opened: fd=%d", socketDescriptor
+      );
+
+      return socketDescriptor;
+    } else {
+      logSystemError("netlink kobject uevent socket bind");
+    }
+
+    close(socketDescriptor);
+  } else {
+    logSystemError("netlink kobject uevent socket creation");
+  }
+
+  return -1;
+}
+
+static int
+monitorUeventSocket (void) {
+  if ((ueventSocket = openUeventSocket()) != -1) {
+    if (asyncMonitorSocketInput(&ueventMonitor, ueventSocket, handleUeventInput, NULL)) {
+      return 1;
+    }
+
+    close(ueventSocket);
+    ueventSocket = -1;
+  }
+
+  return 0;
+}
+#endif /* NETLINK_KOBJECT_UEVENT */
+
+int
+startUeventMonitor (void) {
+#ifdef NETLINK_KOBJECT_UEVENT
+  if (ueventSocket != -1) return 1;
+  if (ueventRestartAlarm) return 1;
+  if (monitorUeventSocket()) return 1;
+#else /* NETLINK_KOBJECT_UEVENT */
+  errno = ENOSYS;
+#endif /* NETLINK_KOBJECT_UEVENT */
+
+  return 0;
+}
+
+void
+stopUeventMonitor (void) {
+#ifdef NETLINK_KOBJECT_UEVENT
+  if (ueventRestartAlarm) {
+    asyncCancelRequest(ueventRestartAlarm);
+    ueventRestartAlarm = NULL;
+  }
+
+  if (ueventMonitor) {
+    asyncCancelRequest(ueventMonitor);
+    ueventMonitor = NULL;
+  }
+
+  if (ueventSocket != -1) {
+    close(ueventSocket);
+    ueventSocket = -1;
+    logMessage(LOG_DEBUG, "netlink kobject uevent socket closed");
+  }
+#endif /* NETLINK_KOBJECT_UEVENT */
+}
+
+int
+isUeventMonitorActive (void) {
+#ifdef NETLINK_KOBJECT_UEVENT
+  return ueventSocket != -1;
+#else /* NETLINK_KOBJECT_UEVENT */
+  return 0;
+#endif /* NETLINK_KOBJECT_UEVENT */
+}
@@ -18,6 +18,7 @@
 
 #include "prologue.h"
 
+#include <stdio.h>
 #include <string.h>
 
 #include "log.h"
@@ -70,6 +71,7 @@ nextBaseCharacter (const UChar **current, const UChar *end) {
 
 #ifdef HAVE_ICONV_H
 #include <iconv.h>
+#include <locale.h>
 #endif /* HAVE_ICONV_H */
 
 int
@@ -109,7 +111,7 @@ getCharacterByAlias (wchar_t *character, const char *alias) {
 }
 
 int
-getCharacterWidth (wchar_t character) {
+computeCharacterWidth (wchar_t character) {
 #if defined(HAVE_WCWIDTH)
   return wcwidth(character);
 #elif defined(HAVE_ICU)
@@ -162,6 +164,21 @@ getCharacterWidth (wchar_t character) {
 #endif /* character width */
 }
 
+#include "unicode_width.h"
+
+int
+getCharacterWidth (wchar_t character) {
+  /* printable ASCII is by far the most common case */
+  if ((character >= WC_C(' ')) && (character < WC_C('~') + 1)) return 1;
+
+  {
+    uint32_t row = (uint32_t)character >> UNICODE_ROW_SHIFT;
+    if (row >= UNICODE_WIDTH_ROW_LIMIT) return computeCharacterWidth(character);
+
+    return unicodeWidthCells[unicodeWidthRows[row]][UNICODE_CELL_NUMBER(character)];
+  }
+}
+
 int
 isBrailleCharacter (wchar_t character) {
   return (character & ~UNICODE_CELL_MASK) == UNICODE_BRAILLE_ROW;
@@ -351,14 +368,85 @@ getTransliteratedCharacter (wchar_t character) {
   return 0;
 }
 
+#include "unicode_fallback.h"
+
+static wchar_t
+getTabulatedBaseCharacter (wchar_t character) {
+  if (isHangulSyllable(character)) return getHangulSyllableBase(character);
+
+  {
+    uint32_t row = (uint32_t)character >> UNICODE_ROW_SHIFT;
+    if (row >= UNICODE_FALLBACK_BASE_ROW_LIMIT) return 0;
+
+    return unicodeFallbackBaseCells[unicodeFallbackBaseRows[row]][UNICODE_CELL_NUMBER(character)];
+  }
+}
+
+static wchar_t
+getTabulatedTransliteratedCharacter (wchar_t character) {
+  uint32_t row = (uint32_t)character >> UNICODE_ROW_SHIFT;
+  if (row >= UNICODE_FALLBACK_TRANSLITERATION_ROW_LIMIT) return 0;
+
+  return unicodeFallbackTransliterationCells[unicodeFallbackTransliterationRows[row]][UNICODE_CELL_NUMBER(character)];
+}
+
+#ifdef HAVE_ICONV_H
+typedef struct {
+  wchar_t character;
+  wchar_t transliteration;
+} TransliterationCacheEntry;
+
+static wchar_t
+getCachedTransliteratedCharacter (wchar_t character) {
+  static char cacheLocale[0X80];
+  static TransliterationCacheEntry cacheEntries[0X100];
+
+  const char *locale = setlocale(LC_CTYPE, NULL);
+  if (!locale) locale = "";
+
+  if (strcmp(locale, cacheLocale) != 0) {
+    memset(cacheEntries, 0, sizeof(cacheEntries));
+    snprintf(cacheLocale, sizeof(cacheLocale), "%s", locale);
+  }
+
+  TransliterationCacheEntry *entry = &cacheEntries[character % ARRAY_COUNT(cacheEntries)];
+
+  if (entry->character != character) {
+    entry->character = character;
+    entry->transliteration = getTransliteratedCharacter(character);
+  }
+
+  return entry->transliteration;
+}
+#endif /* HAVE_ICONV_H */
+
+/* Transliteration depends on the locale (de_DE, for example, spells out
+ * umlauts) so the table is only used within the one it was generated for.
+ */
+static wchar_t
+getLocaleTransliteratedCharacter (wchar_t character) {
+#ifdef HAVE_ICONV_H
+  const char *locale = setlocale(LC_CTYPE, NULL);
+
+  if (!locale || (strcmp(locale, UNICODE_FALLBACK_LOCALE) != 0)) {
+    return getCachedTransliteratedCharacter(character);
+  }
+#endif /* HAVE_ICONV_H */
+
+  return getTabulatedTransliteratedCharacter(character);
+}
+
 int
 handleBestCharacter (wchar_t character, CharacterHandler handleCharacter, void *data) {
   if (isBrailleCharacter(character)) return 0;
 
+  /* These use tables generated (by mkunifb) from what ICU and iconv return
+   * so that neither needs to be called per character at run time.
+   */
   typedef wchar_t CharacterTranslator (wchar_t character);
   static CharacterTranslator *const characterTranslators[] = {
-    getBaseCharacter,
-    getTransliteratedCharacter,
+    getTabulatedBaseCharacter,
+    getLocaleTransliteratedCharacter,
     NULL
   };
 
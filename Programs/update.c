@@ -29,11 +29,13 @@
 #include "update.h"
 #include "async_alarm.h"
 #include "timing.h"
+#include "latency.h"
 #include "unicode.h"
 #include "charset.h"
 #include "ttb.h"
 #include "atb.h"
 #include "brl_dots.h"
+#include "brl_utils.h"
 #include "spk.h"
 #include "scr.h"
 #include "scr_special.h"
@@ -79,6 +81,8 @@ ensureContractedOffsetsSize (size_t size) {
 static int oldwinx;
 static int oldwiny;
 
+static int deferredUpdateDelay;
+
 static int
 checkScreenPointer (void) {
   int moved = 0;
@@ -398,19 +402,14 @@ renderInfoLine (void) {
 
   {
     unsigned int threshold = compact? compactLength: 0;
+    if (threshold > length) threshold = length;
 
-    for (unsigned int i=0; i<length; i+=1) {
-      wint_t character;
-
-      if (i < threshold) {
-        character = UNICODE_BRAILLE_ROW | compactCells[i];
-      } else {
-        character = convertCharToWchar(text[i]);
-        if (character == WEOF) character = WC_C('?');
-      }
-
-      characters[i] = character;
+    for (unsigned int i=0; i<threshold; i+=1) {
+      characters[i] = UNICODE_BRAILLE_ROW | compactCells[i];
     }
+
+    convertCharsToWchars(&text[threshold], &characters[threshold],
+                         length-threshold, WC_C('?'));
   }
 
   return writeBrailleCharacters(mode, characters, length);
@@ -759,7 +758,12 @@ writeBrailleWindow (BrailleDisplay *brl, const wchar_t *text, unsigned char qual
   }
 
   brl->quality = quality;
-  return braille->writeWindow(brl, text);
+
+  {
+    int written = braille->writeWindow(brl, text);
+    traceLatency(getLatencyTrace(), LATENCY_STAGE_OUTPUT);
+    return written;
+  }
 }
 
 static void
@@ -1175,7 +1179,14 @@ doUpdate (void) {
         fillStatusSeparator(textBuffer, brl.buffer);
       }
 
-      if (!(writeStatusCells() && writeBrailleWindow(&brl, textBuffer, scr.quality))) brl.hasFailed = 1;
+      /* without a delay, REPORT_BRAILLE_OUTPUT_READY schedules the update */
+      if (deferBrailleWindow(&brl, &deferredUpdateDelay)) {
+        logMessage(LOG_CATEGORY(UPDATE_EVENTS), "braille output busy");
+      } else if (writeStatusCells() && writeBrailleWindow(&brl, textBuffer, scr.quality)) {
+        noteBrailleWindowWritten(&brl);
+      } else {
+        brl.hasFailed = 1;
+      }
     }
 
     api.releaseDriver();
@@ -1187,6 +1198,7 @@ doUpdate (void) {
 
 static void setUpdateAlarm (void);
 static AsyncHandle updateAlarm;
+static LatencyTrace updateLatency;
 static int updateSuspendCount;
 
 static TimeValue updateTime;
@@ -1226,6 +1238,15 @@ setUpdateTime (int delay, const TimeValue *from, int ifEarlier) {
 
 void
 scheduleUpdateIn (const char *reason, int delay) {
+  {
+    LatencyTrace trace = getLatencyTrace();
+
+    if (trace) {
+      traceLatency(trace, LATENCY_STAGE_SCHEDULED);
+      if (!updateLatency) updateLatency = trace;
+    }
+  }
+
   setUpdateTime(delay, NULL, 1);
   if (updateAlarm) asyncResetAlarmTo(updateAlarm, &updateTime);
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "scheduled: %s", reason);
@@ -1248,7 +1269,13 @@ ASYNC_ALARM_CALLBACK(handleUpdateAlarm) {
     int oldColumn = ses->winx;
     int oldRow = ses->winy;
 
+    deferredUpdateDelay = 0;
+    setLatencyTrace(updateLatency);
+    updateLatency = 0;
+    traceLatency(getLatencyTrace(), LATENCY_STAGE_UPDATE);
+
     doUpdate();
+    setLatencyTrace(0);
 
     if ((ses->winx != oldColumn) || (ses->winy != oldRow)) {
       reportBrailleWindowMoved();
@@ -1257,10 +1284,17 @@ ASYNC_ALARM_CALLBACK(handleUpdateAlarm) {
 
   setUpdateDelay(MAX((brl.writeDelay + 1), UPDATE_SCHEDULE_DELAY));
   brl.writeDelay = 0;
+  if (deferredUpdateDelay) setUpdateTime(deferredUpdateDelay, NULL, 1);
 
   resumeUpdates(0);
 }
 
+static ReportListenerInstance *updateBrailleOutputReadyListener = NULL;
+
+REPORT_LISTENER(handleUpdateBrailleOutputReady) {
+  scheduleUpdate("braille output ready");
+}
+
 static void
 setUpdateAlarm (void) {
   if (!updateSuspendCount && !updateAlarm) {
@@ -1282,6 +1316,7 @@ beginUpdates (void) {
   setUpdateTime(0, NULL, 0);
 
   updateAlarm = NULL;
+  updateLatency = 0;
   updateSuspendCount = 0;
 
   oldwinx = -1;
@@ -1292,6 +1327,7 @@ beginUpdates (void) {
 #endif /* ENABLE_SPEECH_SUPPORT */
 
   updateBrailleDeviceOnlineListener = registerReportListener(REPORT_BRAILLE_DEVICE_ONLINE, handleUpdateBrailleDeviceOnline, NULL);
+  updateBrailleOutputReadyListener = registerReportListener(REPORT_BRAILLE_OUTPUT_READY, handleUpdateBrailleOutputReady, NULL);
 }
 
 void
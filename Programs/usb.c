@@ -745,12 +745,21 @@ usbTestEndpoint (const void *item, void *data) {
   return endpoint->descriptor->bEndpointAddress == *endpointAddress;
 }
 
+static ItemKey
+usbMakeEndpointKey (const void *item, void *queueData) {
+  const UsbEndpoint *endpoint = item;
+  return endpoint->descriptor->bEndpointAddress;
+}
+
 UsbEndpoint *
 usbGetEndpoint (UsbDevice *device, unsigned char endpointAddress) {
   UsbEndpoint *endpoint;
   const UsbEndpointDescriptor *descriptor;
 
-  if ((endpoint = findItem(device->endpoints, usbTestEndpoint, &endpointAddress))) return endpoint;
+  if ((endpoint = findItemWithKey(device->endpoints, endpointAddress,
+                                  usbTestEndpoint, &endpointAddress))) {
+    return endpoint;
+  }
 
   if ((descriptor = usbEndpointDescriptor(device, endpointAddress))) {
     {
@@ -985,6 +994,7 @@ usbCloseDevice (UsbDevice *device) {
 
   usbCloseInterface(device);
   usbRemoveEndpoints(device, 1);
+  usbHidForgetReportTable(device);
 
   if (device->inputFilters) {
     deallocateQueue(device->inputFilters);
@@ -1017,6 +1027,8 @@ usbOpenDevice (UsbDeviceExtension *extension) {
     device->disableEndpointReset = 0;
 
     if ((device->endpoints = newQueue(usbDeallocateEndpoint, NULL))) {
+      setQueueKeyMaker(device->endpoints, usbMakeEndpointKey);
+
       if ((device->inputFilters = newQueue(usbDeallocateInputFilter, NULL))) {
         if (usbReadDeviceDescriptor(device)) {
           if (device->descriptor.bDescriptorType == UsbDescriptorType_Device) {
@@ -1392,6 +1404,7 @@ usbPrepareChannel (UsbChannel *channel) {
 
   if (device->resetDevice) {
     usbResetDevice(device);
+    usbHidForgetReportTable(device);
   }
 
   if (usbConfigureDevice(device, definition->configuration)) {
@@ -1499,6 +1512,20 @@ struct UsbChooseChannelDataStruct {
   unsigned genericDevices:1;
 };
 
+int
+usbIsCandidateDevice (UsbChooseChannelData *data, uint16_t vendor, uint16_t product) {
+  if (data->vendorIdentifier && (data->vendorIdentifier != vendor)) return 0;
+  if (data->productIdentifier && (data->productIdentifier != product)) return 0;
+  if (!usbGetDriverCodes(vendor, product)) return 0;
+
+  for (const UsbChannelDefinition *definition = data->definition;
+       definition->vendor; definition+=1) {
+    if ((definition->vendor == vendor) && (definition->product == product)) return 1;
+  }
+
+  return 0;
+}
+
 static int
 usbChooseChannel (UsbDevice *device, UsbChooseChannelData *data) {
   const UsbDeviceDescriptor *descriptor = &device->descriptor;
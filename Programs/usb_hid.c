@@ -24,6 +24,7 @@
 #include "log.h"
 #include "bitfield.h"
 #include "io_usb.h"
+#include "usb_internal.h"
 
 const unsigned char usbHidItemLengths[] = {0, 1, 2, 4};
 
@@ -160,23 +161,21 @@ usbHidFillReportDescription (
   return found;
 }
 
-int
-usbHidGetReportSize (
-  const unsigned char *items,
-  size_t length,
+static int
+getReportSize (
+  const UsbHidReportDescription *description,
   unsigned char identifier,
-  size_t *size
+  size_t *size,
+  int log
 ) {
-  UsbHidReportDescription description;
-
   *size = 0;
 
-  if (usbHidFillReportDescription(items, length, identifier, &description)) {
-    if (description.defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportCount)) {
-      if (description.defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportSize)) {
-        uint32_t bytes = ((description.reportCount * description.reportSize) + 7) / 8;
+  if (description) {
+    if (description->defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportCount)) {
+      if (description->defined & USB_HID_ITEM_BIT(UsbHidItemType_ReportSize)) {
+        uint32_t bytes = ((description->reportCount * description->reportSize) + 7) / 8;
 
-        logMessage(LOG_CATEGORY(USB_IO), "HID report size: %02X = %"PRIu32, identifier, bytes);
+        if (log) logMessage(LOG_CATEGORY(USB_IO), "HID report size: %02X = %"PRIu32, identifier, bytes);
         *size = 1 + bytes;
         return 1;
       } else {
@@ -192,6 +191,215 @@ usbHidGetReportSize (
   return 0;
 }
 
+int
+usbHidGetReportSize (
+  const unsigned char *items,
+  size_t length,
+  unsigned char identifier,
+  size_t *size
+) {
+  UsbHidReportDescription description;
+  int found = usbHidFillReportDescription(items, length, identifier, &description);
+
+  return getReportSize((found? &description: NULL), identifier, size, 1);
+}
+
+struct UsbHidReportTableStruct {
+  uint16_t indices[0X100]; /* 0 if not found, else 1 + descriptions index */
+  unsigned int count;
+
+  /* a copy of the descriptor the table was built from */
+  const unsigned char *items;
+  size_t size;
+
+  UsbHidReportDescription descriptions[];
+};
+
+UsbHidReportTable *
+usbHidNewReportTable (
+  const unsigned char *items,
+  size_t size
+) {
+  UsbHidReportTable *table;
+  unsigned int count = 0;
+
+  {
+    int index = 0;
+
+    while (index < size) {
+      unsigned char item = items[index++];
+      index += usbHidItemLengths[USB_HID_ITEM_LENGTH(item)];
+      if (USB_HID_ITEM_TYPE(item) == UsbHidItemType_ReportID) count += 1;
+    }
+  }
+
+  if (count > 0X100) count = 0X100;
+
+  if ((table = malloc(sizeof(*table) + ARRAY_SIZE(table->descriptions, count) + size))) {
+    /* the same scan as usbHidFillReportDescription(), for all reports at once */
+    UsbHidReportDescription *description = NULL;
+    int index = 0;
+
+    memset(table->indices, 0, sizeof(table->indices));
+    table->count = 0;
+
+    {
+      unsigned char *copy = (unsigned char *)&table->descriptions[count];
+      memcpy(copy, items, size);
+      table->items = copy;
+      table->size = size;
+    }
+
+    while (index < size) {
+      unsigned char item = items[index++];
+      UsbHidItemType type = USB_HID_ITEM_TYPE(item);
+      unsigned char length = usbHidItemLengths[USB_HID_ITEM_LENGTH(item)];
+      uint32_t value = 0;
+
+      if (length) {
+        unsigned char shift = 0;
+
+        do {
+          if (index == size) {
+            /* the report being described when the items ran out isn't found */
+            if (description) table->indices[description->reportIdentifier] = 0;
+            goto done;
+          }
+
+          value |= items[index++] << shift;
+          shift += 8;
+        } while (--length);
+      }
+
+      switch (type) {
+        case UsbHidItemType_ReportID:
+          description = NULL;
+
+          if ((value <= 0XFF) && !table->indices[value] && (table->count < count)) {
+            description = &table->descriptions[table->count++];
+            memset(description, 0, sizeof(*description));
+            description->reportIdentifier = value;
+            table->indices[value] = table->count;
+          }
+
+          continue;
+
+        case UsbHidItemType_ReportCount:
+          if (description) {
+            description->reportCount = value;
+            goto defined;
+          }
+          break;
+
+        case UsbHidItemType_ReportSize:
+          if (description) {
+            description->reportSize = value;
+            goto defined;
+          }
+          break;
+
+        case UsbHidItemType_LogicalMinimum:
+          if (description) {
+            description->logicalMinimum = value;
+            goto defined;
+          }
+          break;
+
+        case UsbHidItemType_LogicalMaximum:
+          if (description) {
+            description->logicalMaximum = value;
+            goto defined;
+          }
+          break;
+
+        defined:
+          description->defined |= USB_HID_ITEM_BIT(type);
+          continue;
+
+        default:
+          break;
+      }
+
+      description = NULL;
+    }
+
+  done:
+    logMessage(LOG_CATEGORY(USB_IO), "HID reports: %u", table->count);
+
+    for (unsigned int identifier=0; identifier<=0XFF; identifier+=1) {
+      const UsbHidReportDescription *report = usbHidGetReportDescription(table, identifier);
+
+      if (report) {
+        logMessage(LOG_CATEGORY(USB_IO),
+                   "HID report: %02X: Count:%"PRIu32 " Size:%"PRIu32,
+                   identifier, report->reportCount, report->reportSize);
+      }
+    }
+  } else {
+    logMallocError();
+  }
+
+  return table;
+}
+
+void
+usbHidDestroyReportTable (UsbHidReportTable *table) {
+  free(table);
+}
+
+int
+usbHidTestReportTable (
+  const UsbHidReportTable *table,
+  const unsigned char *items,
+  size_t size
+) {
+  if (size != table->size) return 0;
+  return memcmp(items, table->items, size) == 0;
+}
+
+const UsbHidReportDescription *
+usbHidGetReportDescription (
+  const UsbHidReportTable *table,
+  unsigned char identifier
+) {
+  uint16_t index = table->indices[identifier];
+  if (!index) return NULL;
+  return &table->descriptions[index - 1];
+}
+
+int
+usbHidGetCachedReportSize (
+  UsbDevice *device,
+  const unsigned char *items,
+  size_t length,
+  unsigned char identifier,
+  size_t *size
+) {
+  if (device->hidReports) {
+    /* the table is only valid for the descriptor it was built from */
+    if (!usbHidTestReportTable(device->hidReports, items, length)) {
+      usbHidForgetReportTable(device);
+    }
+  }
+
+  if (!device->hidReports) {
+    if (!(device->hidReports = usbHidNewReportTable(items, length))) {
+      return usbHidGetReportSize(items, length, identifier, size);
+    }
+  }
+
+  return getReportSize(usbHidGetReportDescription(device->hidReports, identifier),
+                       identifier, size, 0);
+}
+
+void
+usbHidForgetReportTable (UsbDevice *device) {
+  if (device->hidReports) {
+    usbHidDestroyReportTable(device->hidReports);
+    device->hidReports = NULL;
+  }
+}
+
 ssize_t
 usbHidGetReport (
   UsbDevice *device,
@@ -82,6 +82,7 @@ struct UsbDeviceStruct {
   Queue *endpoints;
   Queue *inputFilters;
   uint16_t language;
+  UsbHidReportTable *hidReports;
   unsigned resetDevice:1;
   unsigned disableEndpointReset:1;
 };
@@ -91,7 +92,9 @@ extern UsbDevice *usbTestDevice (
   UsbDeviceChooser *chooser,
   UsbChooseChannelData *data
 );
+extern int usbIsCandidateDevice (UsbChooseChannelData *data, uint16_t vendor, uint16_t product);
 extern UsbEndpoint *usbGetEndpoint (UsbDevice *device, unsigned char endpointAddress);
+extern void usbHidForgetReportTable (UsbDevice *device);
 extern UsbEndpoint *usbGetInputEndpoint (UsbDevice *device, unsigned char endpointNumber);
 extern UsbEndpoint *usbGetOutputEndpoint (UsbDevice *device, unsigned char endpointNumber);
 extern int usbApplyInputFilters (UsbEndpoint *endpoint, void *buffer, size_t size, ssize_t *length);
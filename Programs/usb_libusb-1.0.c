@@ -465,6 +465,15 @@ usbFindDevice (UsbDeviceChooser *chooser, UsbChooseChannelData *data) {
     while (deviceCount) {
       deviceCount -= 1;
       devx->device = *libusbDevice++;
+
+      {
+        struct libusb_device_descriptor descriptor;
+
+        if (libusb_get_device_descriptor(devx->device, &descriptor) == LIBUSB_SUCCESS) {
+          if (!usbIsCandidateDevice(data, descriptor.idVendor, descriptor.idProduct)) continue;
+        }
+      }
+
       libusb_ref_device(devx->device);
 
       devx->handle = NULL;
@@ -48,6 +48,8 @@
 #include "async_io.h"
 #include "async_signal.h"
 #include "mntpt.h"
+#include "uevent.h"
+#include "program.h"
 #include "io_usb.h"
 #include "usb_internal.h"
 
@@ -59,6 +61,12 @@ typedef struct {
 
 static Queue *usbHostDevices = NULL;
 
+/* The host device list is kept across searches (and forgets) for as long
+ * as the kernel's uevents say that no USB device has been added or removed.
+ */
+static UeventListenerInstance *usbHostDevicesListener = NULL;
+static int usbHostDevicesChanged = 0;
+
 struct UsbDeviceExtensionStruct {
   const UsbHostDevice *host;
   int usbfsFile;
@@ -1217,6 +1225,9 @@ typedef struct {
   UsbDeviceChooser *chooser;
   UsbChooseChannelData *data;
   UsbDevice *device;
+
+  unsigned int skipped;
+  unsigned int tested;
 } UsbTestHostDeviceData;
 
 static int
@@ -1225,6 +1236,13 @@ usbTestHostDevice (void *item, void *data) {
   UsbTestHostDeviceData *test = data;
   UsbDeviceExtension *devx;
 
+  if (!usbIsCandidateDevice(test->data, host->usbDescriptor.idVendor, host->usbDescriptor.idProduct)) {
+    test->skipped += 1;
+    return 0;
+  }
+
+  test->tested += 1;
+
   if ((devx = malloc(sizeof(*devx)))) {
     memset(devx, 0, sizeof(*devx));
     devx->host = host;
@@ -1498,6 +1516,53 @@ usbGetUsbfs (void) {
   return usbGetFileSystem("usbfs", usbfsCandidates, usbTestUsbfs, usbVerifyUsbfs);
 }
 
+static void
+usbDeallocateHostDevices (void) {
+  if (usbHostDevices) {
+    deallocateQueue(usbHostDevices);
+    usbHostDevices = NULL;
+  }
+}
+
+static UEVENT_LISTENER(usbHandleHostDeviceUevent) {
+  const char *type = getUeventProperty(parameters, "DEVTYPE");
+
+  if (!type) return;
+  if (strcmp(type, "usb_device") != 0) return;
+
+  if ((strcmp(parameters->action, "add") == 0) ||
+      (strcmp(parameters->action, "remove") == 0)) {
+    logMessage(LOG_CATEGORY(USB_IO), "host device %s: %s",
+               parameters->action, parameters->device);
+
+    usbHostDevicesChanged = 1;
+  }
+}
+
+static void
+usbExitHostDevices (void *data) {
+  if (usbHostDevicesListener) {
+    unregisterUeventListener(usbHostDevicesListener);
+    usbHostDevicesListener = NULL;
+  }
+
+  usbDeallocateHostDevices();
+}
+
+static void
+usbMonitorHostDevices (void) {
+  if (!usbHostDevicesListener) {
+    if ((usbHostDevicesListener = registerUeventListener("usb", usbHandleHostDeviceUevent, NULL))) {
+      static int first = 1;
+
+      if (first) {
+        first = 0;
+        onProgramExit("usb-host-devices", usbExitHostDevices, NULL);
+      }
+    }
+  }
+}
+
 UsbDevice *
 usbFindDevice (UsbDeviceChooser *chooser, UsbChooseChannelData *data) {
   if (!usbHostDevices) {
@@ -1506,6 +1571,9 @@ usbFindDevice (UsbDeviceChooser *chooser, UsbChooseChannelData *data) {
     if ((usbHostDevices = newQueue(usbDeallocateHostDevice, NULL))) {
       char *root;
 
+      usbMonitorHostDevices();
+      usbHostDevicesChanged = 0;
+
       if ((root = usbGetUsbfs())) {
         logMessage(LOG_CATEGORY(USB_IO), "USBFS root: %s", root);
         if (usbAddHostDevices(root)) ok = 1;
@@ -1529,7 +1597,15 @@ usbFindDevice (UsbDeviceChooser *chooser, UsbChooseChannelData *data) {
       .device = NULL
     };
 
-    if (processQueue(usbHostDevices, usbTestHostDevice, &test)) return test.device;
+    TimeValue start;
+    getMonotonicTime(&start);
+    processQueue(usbHostDevices, usbTestHostDevice, &test);
+
+    logMessage(LOG_CATEGORY(USB_IO),
+               "device search: %u tested, %u skipped, %ldms",
+               test.tested, test.skipped, getMonotonicElapsed(&start));
+
+    if (test.device) return test.device;
   }
 
   return NULL;
@@ -1538,7 +1614,11 @@ usbFindDevice (UsbDeviceChooser *chooser, UsbChooseChannelData *data) {
 void
 usbForgetDevices (void) {
   if (usbHostDevices) {
-    deallocateQueue(usbHostDevices);
-    usbHostDevices = NULL;
+    if (usbHostDevicesListener && !usbHostDevicesChanged) {
+      logMessage(LOG_CATEGORY(USB_IO), "host devices unchanged");
+      return;
+    }
+
+    usbDeallocateHostDevices();
   }
 }